@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "buttonicons.h"
+
+#include <QDir>
+#include <QTest>
+
+#include <cstdlib>
+
+using namespace Breeze;
+
+//* compares every window decoration button icon, rendered with default settings, to the reference images in autotests/data/buttonicons
+/**
+covers every icon style, button type, checked state, boldness and scale, as title bar and as system icons, so that refactors of the icon renderers can be checked to be pixel-identical.
+If KLASSY_UPDATE_ICON_REFERENCES is set, the references are written from the current renders instead, to be committed with an intended change of the icons.
+autotests/render-button-icon-references.sh renders them with the icon renderers of a given commit
+*/
+class ButtonIconReferenceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void icon_data();
+    void icon();
+
+private:
+    //* true if images match within tolerance
+    static bool matches(const QImage &first, const QImage &second);
+
+    QDir m_referenceDir;
+    bool m_update = false;
+
+    //* maximum difference per colour channel, to allow for rounding differences in rasterization
+    static constexpr int m_channelTolerance = 2;
+};
+
+void ButtonIconReferenceTest::initTestCase()
+{
+    // overridable, so that references can be rendered by a build of an earlier commit into this source tree
+    m_referenceDir.setPath(qEnvironmentVariableIsSet("KLASSY_ICON_REFERENCE_DIR") ? qEnvironmentVariable("KLASSY_ICON_REFERENCE_DIR")
+                                                                                   : QStringLiteral(KLASSY_ICON_REFERENCE_DIR));
+    m_update = qEnvironmentVariableIsSet("KLASSY_UPDATE_ICON_REFERENCES");
+    if (m_update) {
+        QVERIFY(m_referenceDir.mkpath(QStringLiteral(".")));
+    }
+}
+
+void ButtonIconReferenceTest::icon_data()
+{
+    QTest::addColumn<int>("iconStyle");
+    QTest::addColumn<int>("type");
+    QTest::addColumn<bool>("checked");
+    QTest::addColumn<bool>("bold");
+    QTest::addColumn<qreal>("devicePixelRatio");
+    QTest::addColumn<bool>("systemIcon");
+    QTest::addColumn<QString>("fileName");
+
+    // title bar icons, and system icons, whose strokes are converted to filled paths
+    for (const bool systemIcon : {false, true}) {
+        for (const auto &iconStyle : ButtonIcons::iconStyles()) {
+            for (const auto &buttonType : ButtonIcons::buttonTypes()) {
+                for (const bool checked : {false, true}) {
+                    for (const bool bold : {false, true}) {
+                        for (const qreal devicePixelRatio : {1.0, 1.25, 1.5, 2.0, 3.0}) {
+                            const QString fileName(QStringLiteral("%1%2-%3%4%5@%6x.png")
+                                                       .arg(systemIcon ? QStringLiteral("system-") : QString(),
+                                                            iconStyle.second,
+                                                            buttonType.second,
+                                                            checked ? QStringLiteral("-checked") : QString(),
+                                                            bold ? QStringLiteral("-bold") : QString(),
+                                                            QString::number(devicePixelRatio)));
+                            QTest::newRow(qPrintable(fileName))
+                                << iconStyle.first << int(buttonType.first) << checked << bold << devicePixelRatio << systemIcon << fileName;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ButtonIconReferenceTest::icon()
+{
+    QFETCH(int, iconStyle);
+    QFETCH(int, type);
+    QFETCH(bool, checked);
+    QFETCH(bool, bold);
+    QFETCH(qreal, devicePixelRatio);
+    QFETCH(bool, systemIcon);
+    QFETCH(QString, fileName);
+
+    // default settings, so that renders do not depend on the user configuration
+    InternalSettingsPtr internalSettings(new InternalSettings());
+    internalSettings->setButtonIconStyle(iconStyle);
+    const QImage image(ButtonIcons::renderIcon(internalSettings, DecorationButtonType(type), checked, bold, devicePixelRatio, systemIcon));
+
+    if (m_update) {
+        QVERIFY(image.save(m_referenceDir.filePath(fileName)));
+        return;
+    }
+
+    const QImage reference(m_referenceDir.filePath(fileName));
+    if (reference.isNull()) {
+        QFAIL(qPrintable(QStringLiteral("Missing reference image %1; see autotests/render-button-icon-references.sh").arg(m_referenceDir.filePath(fileName))));
+    }
+
+    if (!matches(image, reference)) {
+        const QString actualPath(QDir(QDir::tempPath()).filePath(QStringLiteral("klassy-actual-") + fileName));
+        image.save(actualPath);
+        QFAIL(qPrintable(QStringLiteral("Render differs from the reference; it was saved to %1").arg(actualPath)));
+    }
+}
+
+bool ButtonIconReferenceTest::matches(const QImage &first, const QImage &second)
+{
+    if (first.size() != second.size()) {
+        return false;
+    }
+
+    const QImage firstImage(first.convertToFormat(QImage::Format_ARGB32_Premultiplied));
+    const QImage secondImage(second.convertToFormat(QImage::Format_ARGB32_Premultiplied));
+    for (int y = 0; y < firstImage.height(); ++y) {
+        const auto firstLine = reinterpret_cast<const QRgb *>(firstImage.constScanLine(y));
+        const auto secondLine = reinterpret_cast<const QRgb *>(secondImage.constScanLine(y));
+        for (int x = 0; x < firstImage.width(); ++x) {
+            const QRgb a(firstLine[x]);
+            const QRgb b(secondLine[x]);
+            if (std::abs(qRed(a) - qRed(b)) > m_channelTolerance || std::abs(qGreen(a) - qGreen(b)) > m_channelTolerance
+                || std::abs(qBlue(a) - qBlue(b)) > m_channelTolerance || std::abs(qAlpha(a) - qAlpha(b)) > m_channelTolerance) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+QTEST_MAIN(ButtonIconReferenceTest)
+
+#include "buttoniconreferencetest.moc"
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "buttonicons.h"
+#include "renderdecorationbuttonicon.h"
+
+#include <QPainter>
+
+namespace Breeze
+{
+
+const QList<std::pair<int, QString>> &ButtonIcons::iconStyles()
+{
+    static const QList<std::pair<int, QString>> iconStyles{
+        {InternalSettings::EnumButtonIconStyle::StyleMaterialDynamic, QStringLiteral("MaterialDynamic")},
+        {InternalSettings::EnumButtonIconStyle::StyleMaterialCentered, QStringLiteral("MaterialCentered")},
+        {InternalSettings::EnumButtonIconStyle::StyleMaterial, QStringLiteral("Material")},
+        {InternalSettings::EnumButtonIconStyle::StyleOxygen, QStringLiteral("Oxygen")},
+        {InternalSettings::EnumButtonIconStyle::StyleKiteDynamic, QStringLiteral("KiteDynamic")},
+        {InternalSettings::EnumButtonIconStyle::StyleKite, QStringLiteral("Kite")},
+        {InternalSettings::EnumButtonIconStyle::StyleTraditionalDynamic, QStringLiteral("TraditionalDynamic")},
+        {InternalSettings::EnumButtonIconStyle::StyleTraditional, QStringLiteral("Traditional")},
+        {InternalSettings::EnumButtonIconStyle::StyleMetro, QStringLiteral("Metro")},
+        {InternalSettings::EnumButtonIconStyle::StyleFluent, QStringLiteral("Fluent")},
+        {InternalSettings::EnumButtonIconStyle::StyleArk, QStringLiteral("Ark")},
+        {InternalSettings::EnumButtonIconStyle::StyleKisweetDynamic, QStringLiteral("KisweetDynamic")},
+        {InternalSettings::EnumButtonIconStyle::StyleKisweet, QStringLiteral("Kisweet")},
+    };
+    return iconStyles;
+}
+
+const QList<std::pair<DecorationButtonType, QString>> &ButtonIcons::buttonTypes()
+{
+    static const QList<std::pair<DecorationButtonType, QString>> buttonTypes{
+        {DecorationButtonType::ApplicationMenu, QStringLiteral("applicationmenu")},
+        {DecorationButtonType::OnAllDesktops, QStringLiteral("onalldesktops")},
+        {DecorationButtonType::Minimize, QStringLiteral("minimize")},
+        {DecorationButtonType::Maximize, QStringLiteral("maximize")},
+        {DecorationButtonType::Close, QStringLiteral("close")},
+        {DecorationButtonType::ContextHelp, QStringLiteral("contexthelp")},
+        {DecorationButtonType::Shade, QStringLiteral("shade")},
+        {DecorationButtonType::KeepBelow, QStringLiteral("keepbelow")},
+        {DecorationButtonType::KeepAbove, QStringLiteral("keepabove")},
+        {DecorationButtonType::ExcludeFromCapture, QStringLiteral("excludefromcapture")},
+    };
+    return buttonTypes;
+}
+
+void ButtonIcons::paintIcon(QPainter *painter,
+                            InternalSettingsPtr internalSettings,
+                            DecorationButtonType type,
+                            bool checked,
+                            bool bold,
+                            qreal devicePixelRatio,
+                            bool systemIcon)
+{
+    painter->save();
+    painter->setRenderHints(QPainter::Antialiasing);
+
+    // same pen as Button::paint()
+    QPen pen(Qt::black);
+    pen.setWidthF(PenWidth::Symbol * devicePixelRatio);
+    pen.setCosmetic(true);
+    painter->setPen(pen);
+
+    auto [iconRenderer, localRenderingWidth] = RenderDecorationButtonIcon::factory(internalSettings, painter, false, bold, devicePixelRatio);
+    const qreal scaleFactor(qreal(iconSize) / localRenderingWidth);
+    painter->scale(scaleFactor, scaleFactor);
+    if (systemIcon) {
+        iconRenderer->setForceEvenSquares(true);
+        iconRenderer->setStrokeToFilledPath(true);
+    }
+    iconRenderer->renderIcon(type, checked);
+
+    painter->restore();
+}
+
+QImage ButtonIcons::iconImage(qreal devicePixelRatio)
+{
+    QImage image(QSize(iconSize, iconSize) * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(devicePixelRatio);
+    image.fill(Qt::transparent);
+    return image;
+}
+
+QImage
+ButtonIcons::renderIcon(InternalSettingsPtr internalSettings, DecorationButtonType type, bool checked, bool bold, qreal devicePixelRatio, bool systemIcon)
+{
+    QImage image(iconImage(devicePixelRatio));
+    QPainter painter(&image);
+    paintIcon(&painter, internalSettings, type, checked, bold, devicePixelRatio, systemIcon);
+    painter.end();
+    return image;
+}
+
+}
@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "breeze.h"
+
+#include <QImage>
+#include <QList>
+#include <QString>
+
+#include <utility>
+
+class QPainter;
+
+namespace Breeze
+{
+
+//* window decoration button icons as Button::paint() renders them, for the icon tests and benchmarks
+class ButtonIcons
+{
+public:
+    //* icon styles rendered by RenderDecorationButtonIcon::factory(), with a file-name-friendly name
+    static const QList<std::pair<int, QString>> &iconStyles();
+
+    //* button types with an icon, with a file-name-friendly name
+    static const QList<std::pair<DecorationButtonType, QString>> &buttonTypes();
+
+    //* paint a single icon into a painter on an iconSize square device with the given device pixel ratio
+    /** systemIcon renders as SystemIconGenerator does, with strokes converted to filled paths and squares forced to even sizes */
+    static void paintIcon(QPainter *painter,
+                          InternalSettingsPtr internalSettings,
+                          DecorationButtonType type,
+                          bool checked,
+                          bool bold,
+                          qreal devicePixelRatio,
+                          bool systemIcon = false);
+
+    //* render a single icon to a new image
+    static QImage
+    renderIcon(InternalSettingsPtr internalSettings, DecorationButtonType type, bool checked, bool bold, qreal devicePixelRatio, bool systemIcon = false);
+
+    //* an empty image to paint an icon into
+    static QImage iconImage(qreal devicePixelRatio);
+
+    //* logical icon size, as used by default in the title bar
+    static constexpr int iconSize = 18;
+};
+
+}
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#include "cachedpathstroker.h"
+
+#include <QTest>
+
+using namespace Breeze;
+
+class CachedPathStrokerTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void stroke_data();
+    void stroke();
+    void dashOffset();
+    void nearlyEqualPaths();
+
+private:
+    enum class Shape {
+        Cross,
+        Circle,
+        Polyline,
+    };
+    static QPainterPath shape(Shape shape);
+
+    //* exact comparison, as QPainterPath::operator== is fuzzy
+    static bool identical(const QPainterPath &a, const QPainterPath &b);
+};
+
+bool CachedPathStrokerTest::identical(const QPainterPath &a, const QPainterPath &b)
+{
+    if (a.fillRule() != b.fillRule() || a.elementCount() != b.elementCount()) {
+        return false;
+    }
+    for (int i = 0; i < a.elementCount(); ++i) {
+        const QPainterPath::Element elementA(a.elementAt(i));
+        const QPainterPath::Element elementB(b.elementAt(i));
+        if (elementA.type != elementB.type || elementA.x != elementB.x || elementA.y != elementB.y) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QPainterPath CachedPathStrokerTest::shape(Shape shape)
+{
+    QPainterPath path;
+    switch (shape) {
+    case Shape::Cross:
+        path.moveTo(4.5, 4.5);
+        path.lineTo(13.5, 13.5);
+        path.moveTo(4.5, 13.5);
+        path.lineTo(13.5, 4.5);
+        break;
+    case Shape::Circle:
+        path.addEllipse(QRectF(3, 3, 12, 12));
+        break;
+    case Shape::Polyline:
+        path.moveTo(4, 11);
+        path.lineTo(9, 6);
+        path.lineTo(14, 11);
+        break;
+    }
+    return path;
+}
+
+void CachedPathStrokerTest::stroke_data()
+{
+    QTest::addColumn<int>("shape");
+    QTest::addColumn<QPen>("pen");
+
+    QPen pen(Qt::black, 1.01);
+    QTest::newRow("cross") << int(Shape::Cross) << pen;
+    QTest::newRow("circle") << int(Shape::Circle) << pen;
+
+    pen.setWidthF(2.0);
+    pen.setCapStyle(Qt::RoundCap);
+    pen.setJoinStyle(Qt::RoundJoin);
+    QTest::newRow("cross round") << int(Shape::Cross) << pen;
+    QTest::newRow("polyline round") << int(Shape::Polyline) << pen;
+
+    pen.setCapStyle(Qt::FlatCap);
+    pen.setJoinStyle(Qt::MiterJoin);
+    pen.setMiterLimit(4.0);
+    QTest::newRow("polyline miter") << int(Shape::Polyline) << pen;
+
+    pen.setStyle(Qt::DashLine);
+    QTest::newRow("circle dashed") << int(Shape::Circle) << pen;
+
+    pen.setStyle(Qt::CustomDashLine);
+    pen.setDashPattern({1.0, 2.0});
+    QTest::newRow("circle custom dash") << int(Shape::Circle) << pen;
+}
+
+void CachedPathStrokerTest::stroke()
+{
+    QFETCH(int, shape);
+    QFETCH(QPen, pen);
+
+    const QPainterPath path(CachedPathStrokerTest::shape(Shape(shape)));
+
+    const QPainterPath expected(QPainterPathStroker(pen).createStroke(path));
+
+    // the first call creates the stroke and the second is served from the cache
+    QVERIFY(identical(CachedPathStroker(pen).createStroke(path), expected));
+    QVERIFY(identical(CachedPathStroker(pen).createStroke(path), expected));
+}
+
+void CachedPathStrokerTest::dashOffset()
+{
+    QPainterPath line;
+    line.moveTo(2, 9);
+    line.lineTo(16, 9);
+
+    QPen pen(Qt::black, 1.0);
+    pen.setStyle(Qt::DashLine);
+    const QPainterPath stroke(CachedPathStroker(pen).createStroke(line));
+
+    pen.setDashOffset(1.5);
+    const QPainterPath offsetStroke(CachedPathStroker(pen).createStroke(line));
+
+    QVERIFY(identical(offsetStroke, QPainterPathStroker(pen).createStroke(line)));
+    QVERIFY(!identical(offsetStroke, stroke));
+}
+
+void CachedPathStrokerTest::nearlyEqualPaths()
+{
+    // paths within QPainterPath's fuzzy equality must still get their own strokes
+    QPainterPath line;
+    line.moveTo(2, 9);
+    line.lineTo(16, 9);
+
+    QPainterPath nearlyLine;
+    nearlyLine.moveTo(2, 9);
+    nearlyLine.lineTo(16, 9 + 1e-9);
+    QVERIFY(line == nearlyLine);
+
+    const QPen pen(Qt::black, 1.0);
+    CachedPathStroker(pen).createStroke(line);
+    QVERIFY(identical(CachedPathStroker(pen).createStroke(nearlyLine), QPainterPathStroker(pen).createStroke(nearlyLine)));
+}
+
+QTEST_GUILESS_MAIN(CachedPathStrokerTest)
+
+#include "cachedpathstrokertest.moc"
@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezedatamap.h"
+#include "datamaptestdata.h"
+
+#include <QMap>
+#include <QTest>
+
+using namespace Breeze;
+
+//* lookups in DataMap, as done by the animation engines for every widget painted, compared with the QMap it used to be
+class DataMapBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void find_data();
+    void find();
+
+    void qMapFind_data();
+    void qMapFind();
+
+    void insertAndUnregister_data();
+    void insertAndUnregister();
+};
+
+namespace
+{
+void addSizeRows()
+{
+    QTest::addColumn<int>("size");
+    for (const int size : {10, 100, 1000, 10000}) {
+        QTest::addRow("%d widgets", size) << size;
+    }
+}
+}
+
+void DataMapBenchmark::find_data()
+{
+    addSizeRows();
+}
+
+void DataMapBenchmark::find()
+{
+    QFETCH(int, size);
+
+    DataMap<DataMapTestData> map;
+    QList<DataMapTestData *> values;
+    for (int i = 0; i < size; ++i) {
+        values.append(new DataMapTestData);
+        map.insert(dataMapTestKey(i), values.last());
+    }
+
+    // every registered widget, and as many that are not registered
+    const void *found = nullptr;
+    QBENCHMARK {
+        for (int i = 0; i < 2 * size; ++i) {
+            if (map.find(dataMapTestKey(i))) {
+                found = dataMapTestKey(i);
+            }
+        }
+    }
+    QCOMPARE(found, dataMapTestKey(size - 1));
+
+    qDeleteAll(values);
+}
+
+void DataMapBenchmark::qMapFind_data()
+{
+    addSizeRows();
+}
+
+void DataMapBenchmark::qMapFind()
+{
+    QFETCH(int, size);
+
+    QMap<const void *, WeakPointer<DataMapTestData>> map;
+    QList<DataMapTestData *> values;
+    for (int i = 0; i < size; ++i) {
+        values.append(new DataMapTestData);
+        map.insert(dataMapTestKey(i), values.last());
+    }
+
+    const void *found = nullptr;
+    QBENCHMARK {
+        for (int i = 0; i < 2 * size; ++i) {
+            if (map.value(dataMapTestKey(i))) {
+                found = dataMapTestKey(i);
+            }
+        }
+    }
+    QCOMPARE(found, dataMapTestKey(size - 1));
+
+    qDeleteAll(values);
+}
+
+void DataMapBenchmark::insertAndUnregister_data()
+{
+    addSizeRows();
+}
+
+void DataMapBenchmark::insertAndUnregister()
+{
+    QFETCH(int, size);
+
+    // the values are not deleted until events are processed, so the same ones are registered each time
+    QList<DataMapTestData *> values;
+    for (int i = 0; i < size; ++i) {
+        values.append(new DataMapTestData);
+    }
+
+    QBENCHMARK {
+        DataMap<DataMapTestData> map;
+        for (int i = 0; i < size; ++i) {
+            map.insert(dataMapTestKey(i), values.at(i));
+        }
+        for (int i = 0; i < size; ++i) {
+            // forget the value before unregistering, so that it is not deleted
+            map.insert(dataMapTestKey(i), nullptr);
+            map.unregisterWidget(dataMapTestKey(i));
+        }
+    }
+
+    qDeleteAll(values);
+}
+
+QTEST_GUILESS_MAIN(DataMapBenchmark)
+
+#include "datamapbenchmark.moc"
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezedatamap.h"
+#include "datamaptestdata.h"
+
+#include <QRandomGenerator>
+#include <QTest>
+
+#include <map>
+
+using namespace Breeze;
+
+class DataMapTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void cleanup();
+
+    void insertFindRemove();
+    void enabled();
+    void randomizedAgainstStdMap();
+
+private:
+    using Map = DataMap<DataMapTestData>;
+    using ReferenceMap = std::map<const void *, DataMapTestData *>;
+
+    //* check that the map holds exactly the entries of the reference
+    static bool sameEntries(Map &map, const ReferenceMap &reference);
+};
+
+void DataMapTest::cleanup()
+{
+    // values of unregistered keys are deleted later
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+bool DataMapTest::sameEntries(Map &map, const ReferenceMap &reference)
+{
+    if (map.size() != int(reference.size())) {
+        return false;
+    }
+
+    std::size_t count = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        const auto referenceIt = reference.find(it.key());
+        if (referenceIt == reference.end() || it.value().data() != referenceIt->second) {
+            return false;
+        }
+        ++count;
+    }
+    return count == reference.size();
+}
+
+void DataMapTest::insertFindRemove()
+{
+    Map map;
+    QVERIFY(map.isEmpty());
+    QVERIFY(!map.find(dataMapTestKey(0)));
+    QVERIFY(!map.unregisterWidget(dataMapTestKey(0)));
+
+    // null keys are never registered
+    DataMapTestData unregistered;
+    map.insert(nullptr, &unregistered);
+    QVERIFY(map.isEmpty());
+
+    auto *data(new DataMapTestData);
+    map.insert(dataMapTestKey(0), data);
+    QCOMPARE(map.size(), 1);
+    QVERIFY(map.contains(dataMapTestKey(0)));
+    QCOMPARE(map.find(dataMapTestKey(0)).data(), data);
+
+    // inserting an existing key replaces its value
+    auto *otherData(new DataMapTestData);
+    map.insert(dataMapTestKey(0), otherData);
+    QCOMPARE(map.size(), 1);
+    QCOMPARE(map.find(dataMapTestKey(0)).data(), otherData);
+    delete data;
+
+    QVERIFY(map.unregisterWidget(dataMapTestKey(0)));
+    QVERIFY(map.isEmpty());
+    QVERIFY(!map.contains(dataMapTestKey(0)));
+}
+
+void DataMapTest::enabled()
+{
+    Map map;
+    auto *data(new DataMapTestData);
+    map.insert(dataMapTestKey(0), data, false);
+    QVERIFY(!data->enabled());
+
+    map.setEnabled(false);
+    QVERIFY(map.contains(dataMapTestKey(0)));
+    QVERIFY(!map.find(dataMapTestKey(0)));
+
+    map.setEnabled(true);
+    QVERIFY(data->enabled());
+    QCOMPARE(map.find(dataMapTestKey(0)).data(), data);
+
+    map.setDuration(250);
+    QCOMPARE(data->duration(), 250);
+
+    map.unregisterWidget(dataMapTestKey(0));
+}
+
+void DataMapTest::randomizedAgainstStdMap()
+{
+    // a fixed seed, so that a failure can be reproduced
+    QRandomGenerator random(28);
+
+    Map map;
+    ReferenceMap reference;
+
+    // few enough keys that inserts and removals of the same keys are frequent, so probe sequences wrap and shift back
+    constexpr quint32 keyCount = 5000;
+    for (int operation = 0; operation < 100000; ++operation) {
+        const void *key(dataMapTestKey(random.bounded(keyCount)));
+        switch (random.bounded(3)) {
+        case 0: {
+            auto *data(new DataMapTestData);
+            const auto referenceIt = reference.find(key);
+            if (referenceIt != reference.end()) {
+                // a replaced value is not deleted by the map
+                delete referenceIt->second;
+            }
+            map.insert(key, data);
+            reference[key] = data;
+            break;
+        }
+        case 1: {
+            const bool removed(map.unregisterWidget(key));
+            QCOMPARE(removed, reference.erase(key) == 1);
+            break;
+        }
+        default: {
+            const auto referenceIt = reference.find(key);
+            QCOMPARE(map.contains(key), referenceIt != reference.end());
+            QCOMPARE(map.find(key).data(), referenceIt != reference.end() ? referenceIt->second : nullptr);
+            break;
+        }
+        }
+
+        QCOMPARE(map.size(), int(reference.size()));
+        if (operation % 1000 == 0) {
+            QVERIFY(sameEntries(map, reference));
+        }
+    }
+
+    QVERIFY(sameEntries(map, reference));
+
+    for (const auto &entry : reference) {
+        QVERIFY(map.unregisterWidget(entry.first));
+    }
+    QVERIFY(map.isEmpty());
+}
+
+QTEST_GUILESS_MAIN(DataMapTest)
+
+#include "datamaptest.moc"
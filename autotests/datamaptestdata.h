@@ -0,0 +1,49 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QObject>
+
+namespace Breeze
+{
+
+//* minimal animation data stored by the DataMap tests and benchmark
+class DataMapTestData : public QObject
+{
+public:
+    void setEnabled(bool enabled)
+    {
+        _enabled = enabled;
+    }
+
+    bool enabled() const
+    {
+        return _enabled;
+    }
+
+    void setDuration(int duration)
+    {
+        _duration = duration;
+    }
+
+    int duration() const
+    {
+        return _duration;
+    }
+
+private:
+    bool _enabled = true;
+    int _duration = 0;
+};
+
+//* a key as aligned as a widget address
+inline const void *dataMapTestKey(quintptr index)
+{
+    return reinterpret_cast<const void *>((index + 1) * 16);
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "buttonicons.h"
+#include "decorationshadowrenderer.h"
+
+#include <QPainter>
+#include <QTest>
+
+using namespace Breeze;
+
+//* renders window decoration button icons and shadow textures offscreen
+/**
+calls the icon painting and shadow texture rendering of klassycommon that Button::paint() and Decoration::createShadowObject() call,
+so that they can be measured outside of KWin. The rest of those functions needs a decorated window and is not measured.
+Default settings are used, so that results do not depend on the user configuration
+*/
+class DecorationBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void icons_data();
+    void icons();
+
+    void shadows_data();
+    void shadows();
+};
+
+void DecorationBenchmark::icons_data()
+{
+    QTest::addColumn<int>("iconStyle");
+    QTest::addColumn<qreal>("devicePixelRatio");
+    QTest::addColumn<bool>("bold");
+
+    for (const auto &iconStyle : ButtonIcons::iconStyles()) {
+        for (const qreal devicePixelRatio : {1.0, 1.5, 2.0}) {
+            for (const bool bold : {false, true}) {
+                QTest::addRow("%s @%gx%s", qPrintable(iconStyle.second), devicePixelRatio, bold ? " bold" : "") << iconStyle.first << devicePixelRatio << bold;
+            }
+        }
+    }
+}
+
+void DecorationBenchmark::icons()
+{
+    QFETCH(int, iconStyle);
+    QFETCH(qreal, devicePixelRatio);
+    QFETCH(bool, bold);
+
+    InternalSettingsPtr internalSettings(new InternalSettings());
+    internalSettings->setButtonIconStyle(iconStyle);
+
+    QImage image(ButtonIcons::iconImage(devicePixelRatio));
+    QPainter painter(&image);
+
+    // every button type and checked state, as in a full title bar repaint
+    QBENCHMARK {
+        for (const auto &buttonType : ButtonIcons::buttonTypes()) {
+            for (const bool checked : {false, true}) {
+                ButtonIcons::paintIcon(&painter, internalSettings, buttonType.first, checked, bold, devicePixelRatio);
+            }
+        }
+    }
+}
+
+void DecorationBenchmark::shadows_data()
+{
+    QTest::addColumn<int>("shadowSize");
+    QTest::addColumn<qreal>("cornerRadius");
+    QTest::addColumn<bool>("outline");
+
+    const QList<std::pair<int, QString>> shadowSizes{
+        {InternalSettings::EnumShadowSize::ShadowSmall, QStringLiteral("Small")},
+        {InternalSettings::EnumShadowSize::ShadowMedium, QStringLiteral("Medium")},
+        {InternalSettings::EnumShadowSize::ShadowLarge, QStringLiteral("Large")},
+        {InternalSettings::EnumShadowSize::ShadowVeryLarge, QStringLiteral("VeryLarge")},
+    };
+
+    for (const auto &shadowSize : shadowSizes) {
+        for (const qreal cornerRadius : {0.0, 3.0, 6.0, 12.0}) {
+            for (const bool outline : {false, true}) {
+                QTest::addRow("%s radius %g%s", qPrintable(shadowSize.second), cornerRadius, outline ? " outline" : "")
+                    << shadowSize.first << cornerRadius << outline;
+            }
+        }
+    }
+}
+
+void DecorationBenchmark::shadows()
+{
+    QFETCH(int, shadowSize);
+    QFETCH(qreal, cornerRadius);
+    QFETCH(bool, outline);
+
+    InternalSettingsPtr internalSettings(new InternalSettings());
+    const CompositeShadowParams params(lookupDecorationShadowParams(shadowSize));
+
+    // a window with all its sides and corners, as created by Decoration::createShadowObject() for a window away from the screen edges
+    DecorationShadowOutline shadowOutline;
+    if (outline) {
+        shadowOutline.color = QColor(255, 255, 255, 64);
+        shadowOutline.penWidth = internalSettings->windowOutlineThickness();
+        shadowOutline.overlap = internalSettings->windowOutlineOverlap() ? 0.5 : 0;
+        shadowOutline.squareCorners = cornerRadius < 0.4;
+    }
+
+    QBENCHMARK {
+        const DecorationShadowTexture shadowTexture(DecorationShadowRenderer::render(params, Qt::black, cornerRadius, AllCorners, shadowOutline));
+        Q_UNUSED(shadowTexture);
+    }
+}
+
+QTEST_MAIN(DecorationBenchmark)
+
+#include "decorationbenchmark.moc"
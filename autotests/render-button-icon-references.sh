@@ -0,0 +1,46 @@
+#!/bin/sh
+#
+# SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+#
+# SPDX-License-Identifier: MIT
+#
+# Renders the reference images of buttoniconreferencetest into autotests/data/buttonicons
+# with the button icon renderers of the given commit, so that later changes to the renderers
+# are compared against their earlier output.
+#
+# usage: autotests/render-button-icon-references.sh [commit]
+# The default commit is the baseline, from before the icon renderers were optimised.
+
+set -e
+
+commit=${1:-5af0f49}
+source=$(git rev-parse --show-toplevel)
+work=$(mktemp -d)
+tree="$work/tree"
+build="$work/build"
+
+cleanup() {
+    git -C "$source" worktree remove --force "$tree" 2>/dev/null || true
+    rm -rf "$work"
+}
+trap cleanup EXIT
+
+git -C "$source" worktree add --detach "$tree" "$commit"
+
+# the test and its helpers from this tree, built against the renderers of the given commit
+rm -rf "$tree/autotests"
+cp -r "$source/autotests" "$tree/autotests"
+cat >> "$tree/CMakeLists.txt" <<'CMAKE'
+set(CMAKE_AUTOMOC ON)
+find_package(Qt6 ${QT_MIN_VERSION} CONFIG REQUIRED Test)
+add_subdirectory(autotests)
+CMAKE
+
+cmake -S "$tree" -B "$build" -DBUILD_QT5=OFF -DBUILD_TESTING=ON -DWITH_DECORATIONS=OFF
+cmake --build "$build" --target buttoniconreferencetest -j"$(nproc)"
+
+test=$(find "$build" -name buttoniconreferencetest -type f -perm -u+x | head -n 1)
+rm -rf "$source/autotests/data/buttonicons"
+QT_QPA_PLATFORM=offscreen KLASSY_UPDATE_ICON_REFERENCES=1 KLASSY_ICON_REFERENCE_DIR="$source/autotests/data/buttonicons" "$test"
+
+echo "References rendered by $commit written to autotests/data/buttonicons"
@@ -0,0 +1,237 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <QImage>
+#include <QPainter>
+#include <QPluginLoader>
+#include <QStyle>
+#include <QStyleOption>
+#include <QStylePlugin>
+#include <QTest>
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+//* renders representative widget primitives through the Klassy style of the build tree into offscreen images
+/** run with QT_QPA_PLATFORM=offscreen for results independent of the display server */
+class StyleBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void render_data();
+    void render();
+
+private:
+    struct BenchmarkCase {
+        QString name;
+        QSize size;
+        std::function<void(QPainter *, const QRect &)> render;
+    };
+
+    //* the cases to render
+    QList<BenchmarkCase> benchmarkCases() const;
+
+    std::unique_ptr<QStyle> m_style;
+    QPalette m_palette;
+    QList<BenchmarkCase> m_cases;
+};
+
+void StyleBenchmark::initTestCase()
+{
+    // the style plugin of the build tree, rather than whichever is installed
+    QPluginLoader loader(QStringLiteral(KLASSY_STYLE_PLUGIN));
+    auto plugin = qobject_cast<QStylePlugin *>(loader.instance());
+    QVERIFY2(plugin, qPrintable(loader.errorString()));
+
+    m_style.reset(plugin->create(QStringLiteral("Klassy")));
+    QVERIFY(m_style);
+    m_palette = m_style->standardPalette();
+    m_cases = benchmarkCases();
+}
+
+void StyleBenchmark::cleanupTestCase()
+{
+    m_cases.clear();
+    m_style.reset();
+}
+
+void StyleBenchmark::render_data()
+{
+    QTest::addColumn<int>("caseIndex");
+    QTest::addColumn<qreal>("devicePixelRatio");
+
+    for (int i = 0; i < m_cases.size(); ++i) {
+        for (const qreal devicePixelRatio : {1.0, 1.5, 2.0}) {
+            QTest::addRow("%s @%gx", qPrintable(m_cases.at(i).name), devicePixelRatio) << i << devicePixelRatio;
+        }
+    }
+}
+
+void StyleBenchmark::render()
+{
+    QFETCH(int, caseIndex);
+    QFETCH(qreal, devicePixelRatio);
+    const BenchmarkCase &benchmarkCase(m_cases.at(caseIndex));
+
+    QImage image((QSizeF(benchmarkCase.size) * devicePixelRatio).toSize(), QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(devicePixelRatio);
+    const QRect rect(QPoint(0, 0), benchmarkCase.size);
+
+    QPainter painter(&image);
+
+    // warm up style caches, so that the one-off cost of the first render is not measured
+    benchmarkCase.render(&painter, rect);
+
+    QBENCHMARK {
+        benchmarkCase.render(&painter, rect);
+    }
+}
+
+QList<StyleBenchmark::BenchmarkCase> StyleBenchmark::benchmarkCases() const
+{
+    QList<BenchmarkCase> cases;
+    QStyle *style(m_style.get());
+
+    const auto initOption = [this](QStyleOption &option, const QRect &rect, QStyle::State state) {
+        option.rect = rect;
+        option.palette = m_palette;
+        option.state = state | QStyle::State_Enabled;
+        option.direction = Qt::LeftToRight;
+    };
+
+    // buttons
+    for (const auto &entry : QList<std::pair<QString, QStyle::State>>{{QStringLiteral("push button"), QStyle::State_Raised},
+                                                                      {QStringLiteral("push button (hover)"), QStyle::State_Raised | QStyle::State_MouseOver},
+                                                                      {QStringLiteral("push button (sunken)"), QStyle::State_Sunken}}) {
+        const QString &name(entry.first);
+        const auto state(entry.second);
+        cases.append({name, QSize(120, 32), [style, initOption, state](QPainter *painter, const QRect &rect) {
+                          QStyleOptionButton option;
+                          initOption(option, rect, state);
+                          option.text = QStringLiteral("Button");
+                          style->drawControl(QStyle::CE_PushButton, &option, painter, nullptr);
+                      }});
+    }
+
+    // check boxes and radio buttons
+    for (const auto &entry : QList<std::pair<QString, QStyle::State>>{{QStringLiteral("check box (off)"), QStyle::State_Off},
+                                                                      {QStringLiteral("check box (on)"), QStyle::State_On},
+                                                                      {QStringLiteral("check box (partial)"), QStyle::State_NoChange}}) {
+        const QString &name(entry.first);
+        const auto state(entry.second);
+        cases.append({name, QSize(120, 24), [style, initOption, state](QPainter *painter, const QRect &rect) {
+                          QStyleOptionButton option;
+                          initOption(option, rect, state);
+                          option.text = QStringLiteral("Check box");
+                          style->drawControl(QStyle::CE_CheckBox, &option, painter, nullptr);
+                      }});
+    }
+
+    cases.append({QStringLiteral("radio button (on)"), QSize(120, 24), [style, initOption](QPainter *painter, const QRect &rect) {
+                      QStyleOptionButton option;
+                      initOption(option, rect, QStyle::State_On);
+                      option.text = QStringLiteral("Radio button");
+                      style->drawControl(QStyle::CE_RadioButton, &option, painter, nullptr);
+                  }});
+
+    // tab bar tabs
+    for (const auto &entry : QList<std::pair<QString, QStyle::State>>{{QStringLiteral("tab (selected)"), QStyle::State_Selected},
+                                                                      {QStringLiteral("tab"), QStyle::State_None}}) {
+        const QString &name(entry.first);
+        const auto state(entry.second);
+        cases.append({name, QSize(140, 32), [style, initOption, state](QPainter *painter, const QRect &rect) {
+                          QStyleOptionTab option;
+                          initOption(option, rect, state);
+                          option.text = QStringLiteral("Tab");
+                          option.shape = QTabBar::RoundedNorth;
+                          option.position = QStyleOptionTab::Middle;
+                          style->drawControl(QStyle::CE_TabBarTab, &option, painter, nullptr);
+                      }});
+    }
+
+    // scrollbars
+    for (const auto &entry : QList<std::pair<QString, Qt::Orientation>>{{QStringLiteral("scrollbar (vertical)"), Qt::Vertical},
+                                                                        {QStringLiteral("scrollbar (horizontal)"), Qt::Horizontal}}) {
+        const QString &name(entry.first);
+        const auto orientation(entry.second);
+        const QSize size(orientation == Qt::Vertical ? QSize(16, 400) : QSize(400, 16));
+        cases.append({name, size, [style, initOption, orientation](QPainter *painter, const QRect &rect) {
+                          QStyleOptionSlider option;
+                          initOption(option, rect, orientation == Qt::Horizontal ? QStyle::State_Horizontal : QStyle::State_None);
+                          option.orientation = orientation;
+                          option.minimum = 0;
+                          option.maximum = 1000;
+                          option.sliderPosition = option.sliderValue = 250;
+                          option.pageStep = 100;
+                          option.subControls = QStyle::SC_All;
+                          style->drawComplexControl(QStyle::CC_ScrollBar, &option, painter, nullptr);
+                      }});
+    }
+
+    // item view rows
+    for (const auto &entry : QList<std::pair<QString, QStyle::State>>{{QStringLiteral("item view row"), QStyle::State_None},
+                                                                      {QStringLiteral("item view row (selected)"), QStyle::State_Selected | QStyle::State_Active},
+                                                                      {QStringLiteral("item view row (hover)"), QStyle::State_MouseOver}}) {
+        const QString &name(entry.first);
+        const auto state(entry.second);
+        cases.append({name, QSize(300, 28), [style, initOption, state](QPainter *painter, const QRect &rect) {
+                          QStyleOptionViewItem option;
+                          initOption(option, rect, state);
+                          option.features = QStyleOptionViewItem::HasDisplay;
+                          option.text = QStringLiteral("Item");
+                          option.viewItemPosition = QStyleOptionViewItem::OnlyOne;
+                          style->drawControl(QStyle::CE_ItemViewItem, &option, painter, nullptr);
+                      }});
+    }
+
+    // menus
+    cases.append({QStringLiteral("menu frame"), QSize(200, 300), [style, initOption](QPainter *painter, const QRect &rect) {
+                      QStyleOption option;
+                      initOption(option, rect, QStyle::State_None);
+                      style->drawPrimitive(QStyle::PE_PanelMenu, &option, painter, nullptr);
+                  }});
+
+    for (const auto &entry : QList<std::pair<QString, QStyle::State>>{{QStringLiteral("menu item"), QStyle::State_None},
+                                                                      {QStringLiteral("menu item (selected)"), QStyle::State_Selected}}) {
+        const QString &name(entry.first);
+        const auto state(entry.second);
+        cases.append({name, QSize(200, 28), [style, initOption, state](QPainter *painter, const QRect &rect) {
+                          QStyleOptionMenuItem option;
+                          initOption(option, rect, state);
+                          option.menuItemType = QStyleOptionMenuItem::Normal;
+                          option.text = QStringLiteral("Menu item\tCtrl+M");
+                          option.maxIconWidth = 16;
+                          style->drawControl(QStyle::CE_MenuItem, &option, painter, nullptr);
+                      }});
+    }
+
+    // progress bars
+    for (const auto &entry : QList<std::pair<QString, int>>{{QStringLiteral("progress bar"), 100}, {QStringLiteral("progress bar (busy)"), 0}}) {
+        const QString &name(entry.first);
+        const auto maximum(entry.second);
+        cases.append({name, QSize(300, 24), [style, initOption, maximum](QPainter *painter, const QRect &rect) {
+                          QStyleOptionProgressBar option;
+                          initOption(option, rect, QStyle::State_Horizontal);
+                          option.minimum = 0;
+                          option.maximum = maximum;
+                          option.progress = maximum / 2;
+                          option.textVisible = true;
+                          option.text = QStringLiteral("50%");
+                          style->drawControl(QStyle::CE_ProgressBar, &option, painter, nullptr);
+                      }});
+    }
+
+    return cases;
+}
+
+QTEST_MAIN(StyleBenchmark)
+
+#include "stylebenchmark.moc"
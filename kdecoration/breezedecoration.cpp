@@ -13,13 +13,15 @@
 #include "setqdebug_logging.h"
 #endif
 
-#include "breezeboxshadowrenderer.h"
 #include "breezebutton.h"
 #include "breezesettingsprovider.h"
 #include "dbusupdatenotifier.h"
+#include "decorationshadowrenderer.h"
 #include "geometrytools.h"
 #include "kdecorationglobals.h"
 #include "plasmatools.h"
+#include "presetloadjob.h"
+#include "shadowparams.h"
 
 #include <KDecoration3/DecoratedWindow>
 #include <KDecoration3/DecorationButtonGroup>
@@ -45,84 +47,6 @@
 
 K_PLUGIN_FACTORY_WITH_JSON(BreezeDecoFactory, "breeze.json", registerPlugin<Breeze::Decoration>(); registerPlugin<Breeze::Button>();)
 
-namespace
-{
-struct ShadowParams {
-    ShadowParams()
-        : offset(QPoint(0, 0))
-        , radius(0)
-        , opacity(0)
-    {
-    }
-
-    ShadowParams(const QPoint &offset, int radius, qreal opacity)
-        : offset(offset)
-        , radius(radius)
-        , opacity(opacity)
-    {
-    }
-
-    QPoint offset;
-    int radius;
-    qreal opacity;
-};
-
-struct CompositeShadowParams {
-    CompositeShadowParams() = default;
-
-    CompositeShadowParams(const QPoint &offset, const ShadowParams &shadow1, const ShadowParams &shadow2)
-        : offset(offset)
-        , shadow1(shadow1)
-        , shadow2(shadow2)
-    {
-    }
-
-    bool isNone() const
-    {
-        return qMax(shadow1.radius, shadow2.radius) == 0;
-    }
-
-    QPoint offset;
-    ShadowParams shadow1;
-    ShadowParams shadow2;
-};
-
-const CompositeShadowParams s_shadowParams[] = {
-    // None
-    CompositeShadowParams( // hacked in by PAM with small values except with opacity 0; this is to allow a thin window outline to be drawn without a shadow
-        QPoint(0, 4),
-        ShadowParams(QPoint(0, 0), 16, 0),
-        ShadowParams(QPoint(0, -2), 8, 0)),
-    // Small
-    CompositeShadowParams(QPoint(0, 4), ShadowParams(QPoint(0, 0), 16, 1), ShadowParams(QPoint(0, -2), 8, 0.4)),
-    // Medium
-    CompositeShadowParams(QPoint(0, 8), ShadowParams(QPoint(0, 0), 32, 0.9), ShadowParams(QPoint(0, -4), 16, 0.3)),
-    // Large
-    CompositeShadowParams(QPoint(0, 12), ShadowParams(QPoint(0, 0), 48, 0.8), ShadowParams(QPoint(0, -6), 24, 0.2)),
-    // Very large
-    CompositeShadowParams(QPoint(0, 16), ShadowParams(QPoint(0, 0), 64, 0.7), ShadowParams(QPoint(0, -8), 32, 0.1)),
-};
-
-inline CompositeShadowParams lookupShadowParams(int size)
-{
-    switch (size) {
-    case Breeze::InternalSettings::EnumShadowSize::ShadowNone:
-        return s_shadowParams[0];
-    case Breeze::InternalSettings::EnumShadowSize::ShadowSmall:
-        return s_shadowParams[1];
-    case Breeze::InternalSettings::EnumShadowSize::ShadowMedium:
-        return s_shadowParams[2];
-    case Breeze::InternalSettings::EnumShadowSize::ShadowLarge:
-        return s_shadowParams[3];
-    case Breeze::InternalSettings::EnumShadowSize::ShadowVeryLarge:
-        return s_shadowParams[4];
-    default:
-        // Fallback to the Large size.
-        return s_shadowParams[3];
-    }
-}
-}
-
 namespace Breeze
 {
 
@@ -353,7 +277,7 @@ bool Decoration::init()
 
     // color cache update
     // The slot will only update if the UUID has changed, hence preventing unnecessary multiple colour cache updates
-    connect(&g_dBusUpdateNotifier, &DBusUpdateNotifier::decorationSettingsUpdate, this, &Decoration::generateDecorationColorsOnDecorationColorSettingsUpdate);
+    connect(&g_dBusUpdateNotifier, &DBusUpdateNotifier::decorationSettingsUpdate, this, &Decoration::reconfigureOnSettingsChange);
     connect(&g_dBusUpdateNotifier, &DBusUpdateNotifier::systemColorSchemeUpdate, this, &Decoration::generateDecorationColorsOnSystemColorSettingsUpdate);
     connect(&g_dBusUpdateNotifier, &DBusUpdateNotifier::systemIconsUpdate, this, [this]() {
         if (m_internalSettings->buttonIconStyle() == InternalSettings::EnumButtonIconStyle::StyleSystemIconTheme) {
@@ -613,7 +537,25 @@ void Decoration::reconfigureMain(const bool noUpdateShadow)
     setGlobalLookAndFeelOptions(lookAndFeelPackage);
 
     // animation
+    updateAnimationDurations();
+
+    // borders
+    recalculateBorders();
+
+    updateOpaque();
+    updateBlur();
+
+    // shadow
+    if (!noUpdateShadow)
+        this->updateShadow();
+
+    Q_EMIT reconfigured();
+}
+
+void Decoration::updateAnimationDurations()
+{
     if (m_internalSettings->animationsEnabled()) {
+        const KConfigGroup cg(s_kdeGlobalConfig, QStringLiteral("KDE"));
         qreal animationsDurationFactorRelativeSystem = 1;
         if (m_internalSettings->animationsSpeedRelativeSystem() < 0)
             animationsDurationFactorRelativeSystem = (-m_internalSettings->animationsSpeedRelativeSystem() + 2) / 2.0f;
@@ -627,18 +569,6 @@ void Decoration::reconfigureMain(const bool noUpdateShadow)
         m_shadowAnimation->setDuration(0);
         m_overrideOutlineFromButtonAnimation->setDuration(0);
     }
-
-    // borders
-    recalculateBorders();
-
-    updateOpaque();
-    updateBlur();
-
-    // shadow
-    if (!noUpdateShadow)
-        this->updateShadow();
-
-    Q_EMIT reconfigured();
 }
 
 void Decoration::updateDecorationColors(const QPalette &clientPalette, QByteArray uuid)
@@ -758,6 +688,42 @@ void Decoration::generateDecorationColorsOnDecorationColorSettingsUpdate(QByteAr
     updateDecorationColors(clientPalette, uuid);
 }
 
+void Decoration::reconfigureOnSettingsChange(QByteArray uuid, SettingsChanges changes)
+{
+    // geometry, icon and exception changes are followed by a kwinReloadConfig, which runs a full reconfigureMain().
+    // reconfigureMain() only regenerates the colours on a palette change, so they are still regenerated here when affected
+    const bool fullReconfigure = changes & (SettingsChangeGeometry | SettingsChangeIcons | SettingsChangeExceptions);
+    if (changes & (SettingsChangeColors | SettingsChangeShadow | SettingsChangeIcons | SettingsChangeExceptions)) {
+        generateDecorationColorsOnDecorationColorSettingsUpdate(uuid);
+    } else if (!fullReconfigure && (changes & SettingsChangeAnimation)) {
+        SettingsProvider::self()->reconfigure();
+        m_internalSettings = SettingsProvider::self()->internalSettings(this);
+    }
+
+    if (fullReconfigure) {
+        return;
+    }
+
+    if (changes & SettingsChangeAnimation) {
+        updateAnimationDurations();
+    }
+
+    if (changes & SettingsChangeColors) {
+        updateOpaque();
+        updateBlur();
+    }
+
+    // updateShadow() compares against the cached shadow settings, so only regenerates the shadow when needed
+    if (changes & (SettingsChangeColors | SettingsChangeShadow)) {
+        updateShadow();
+    }
+
+    if (changes & (SettingsChangeColors | SettingsChangeAnimation)) {
+        Q_EMIT reconfigured(); // this will trigger Button::reconfigure
+        update();
+    }
+}
+
 void Decoration::generateDecorationColorsOnSystemColorSettingsUpdate(QByteArray uuid)
 {
     auto c = window();
@@ -795,8 +761,12 @@ void Decoration::setGlobalLookAndFeelOptions(QString lookAndFeelPackageName)
             }
         }
 
-        if (!presetToLoad.isEmpty()) { // if matching look-and-feel-package, load the associated Klassy window decoration preset
-            system("klassy-settings -w \"" + presetToLoad.toUtf8() + "\" &");
+        // if matching look-and-feel-package, load the associated Klassy window decoration preset
+        // this is done in-process rather than by running klassy-settings, as the compositor must not fork,
+        // and on a background thread, as reading and writing the configuration files must not block the compositor.
+        // KWin is told to reload its configuration once the preset is loaded
+        if (!presetToLoad.isEmpty()) {
+            g_presetLoadJob.start(presetToLoad, true);
         }
     }
 }
@@ -1793,158 +1763,80 @@ std::shared_ptr<KDecoration3::DecorationShadow> Decoration::createShadowObject(Q
         return nullptr;
     }
 
-    const CompositeShadowParams params = lookupShadowParams(active ? m_internalSettings->shadowSize(true) : m_internalSettings->shadowSize(false));
-
-    qreal shadow1Radius = params.shadow1.radius;
-    qreal shadow2Radius = params.shadow2.radius;
-
-    QSize boxSize =
-        BoxShadowRenderer::calculateMinimumBoxSize(std::round(shadow1Radius)).expandedTo(BoxShadowRenderer::calculateMinimumBoxSize(std::round(shadow2Radius)));
-
-    BoxShadowRenderer shadowRenderer;
-
-    shadowRenderer.setBorderRadius((m_scaledCornerRadius + 0.5));
-    shadowRenderer.setBoxSize(boxSize);
-    shadowRenderer.addShadow(params.shadow1.offset, shadow1Radius, ColorTools::alphaMix(shadowColor, params.shadow1.opacity));
-    shadowRenderer.addShadow(params.shadow2.offset, shadow2Radius, ColorTools::alphaMix(shadowColor, params.shadow2.opacity));
-
-    QImage shadowTexture = shadowRenderer.render();
-
-    QPainter painter(&shadowTexture);
-    painter.setRenderHint(QPainter::Antialiasing);
-
-    const QRect outerRect = shadowTexture.rect();
-
-    QRect boxRect(QPoint(0, 0), boxSize);
-    boxRect.moveCenter(outerRect.center());
+    const CompositeShadowParams params = lookupDecorationShadowParams(active ? m_internalSettings->shadowSize(true) : m_internalSettings->shadowSize(false));
 
-    qreal shadowOverlap = Metrics::Decoration_Shadow_Overlap;
-    qreal shadowOffsetX = params.offset.x();
-    qreal shadowOffsetY = params.offset.y();
-
-    // Mask out inner rect.
-    const QMargins padding = QMargins(boxRect.left() - outerRect.left() - shadowOverlap - shadowOffsetX,
-                                      boxRect.top() - outerRect.top() - shadowOverlap - shadowOffsetY,
-                                      outerRect.right() - boxRect.right() - shadowOverlap + shadowOffsetX,
-                                      outerRect.bottom() - boxRect.bottom() - shadowOverlap + shadowOffsetY);
-
-    const QRectF innerRect = outerRect - padding;
-
-    painter.setPen(Qt::NoPen);
-    painter.setBrush(Qt::black);
-    painter.setCompositionMode(QPainter::CompositionMode_DestinationOut);
-
-    QPainterPath roundedRectMask;
+    Corners maskCorners;
     if (hasNoBorders() && !m_internalSettings->roundAllCornersWhenNoBorders() && !c->isShaded()) {
-        if (hideTitleBar()) {
-            roundedRectMask.addRect(innerRect);
-        } else {
-            roundedRectMask = GeometryTools::roundedPath(innerRect, CornersTop, (m_scaledCornerRadius + 0.5));
+        if (!hideTitleBar()) {
+            maskCorners = CornersTop;
         }
     } else {
-        roundedRectMask.addRoundedRect(innerRect, (m_scaledCornerRadius + 0.5), (m_scaledCornerRadius + 0.5));
+        maskCorners = AllCorners;
     }
 
-    painter.drawPath(roundedRectMask);
-
-    // Draw Thin window outline
+    // Thin window outline
+    DecorationShadowOutline outline;
     if (!windowOutlineNone || isWindowOutlineOverride) {
-        if (m_windowOutline.isValid()) {
-            QPen p;
-            p.setColor(m_windowOutline);
-            // use a miter join rather than the default bevel join to get sharp corners at low radii
-            if (m_internalSettings->windowCornerRadius() < 0.4)
-                p.setJoinStyle(Qt::MiterJoin);
-            qreal outlinePenWidth;
-
-            if (KWindowSystem::isPlatformX11()) {
-                outlinePenWidth = m_internalSettings->windowOutlineThickness() * m_systemScaleFactorX11;
-                if (m_internalSettings->windowOutlineSnapToWholePixel()) {
-                    outlinePenWidth = std::round(outlinePenWidth);
-                }
-            } else {
-                outlinePenWidth = m_internalSettings->windowOutlineThickness();
-                if (m_internalSettings->windowOutlineSnapToWholePixel()) {
-                    outlinePenWidth = KDecoration3::snapToPixelGrid(outlinePenWidth, scale);
-                }
+        outline.color = m_windowOutline;
+        outline.squareCorners = m_internalSettings->windowCornerRadius() < 0.4;
+
+        if (KWindowSystem::isPlatformX11()) {
+            outline.penWidth = m_internalSettings->windowOutlineThickness() * m_systemScaleFactorX11;
+            if (m_internalSettings->windowOutlineSnapToWholePixel()) {
+                outline.penWidth = std::round(outline.penWidth);
             }
-            // the overlap between the thin window outline and behind the window in unscaled pixels.,
-            // and also makes sure that the anti-aliasing blends properly between the window and thin window outline
-            qreal outlineOverlap, outlinePenWidthWithOverlap;
-            outlineOverlap = m_internalSettings->windowOutlineOverlap() ? 0.5 : 0;
-            outlinePenWidthWithOverlap = outlinePenWidth + outlineOverlap;
-
-            qreal halfOutlinePenWidth = outlinePenWidth / 2;
-            qreal outlineAdjustment = halfOutlinePenWidth - outlineOverlap;
-            QRectF outlineRect;
-            outlineRect =
-                innerRect.adjusted(-outlineAdjustment,
-                                   -outlineAdjustment,
-                                   outlineAdjustment,
-                                   outlineAdjustment); // make thin window outline rect larger so most is outside the window, except for a 0.5px scaled overlap
-            p.setWidthF(outlinePenWidthWithOverlap);
-            painter.setPen(p);
-            painter.setBrush(Qt::NoBrush);
-            painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-
-            QPainterPath outlinePath;
-            qreal cornerRadius;
-
-            if (m_internalSettings->windowCornerRadius() < 0.4)
-                cornerRadius = m_scaledCornerRadius; // give a square corner for when corner radius is 0
-            else
-                cornerRadius = m_scaledCornerRadius + halfOutlinePenWidth; // else round corner slightly more to account for pen width
-
-            Sides outlineSides;
+        } else {
+            outline.penWidth = m_internalSettings->windowOutlineThickness();
+            if (m_internalSettings->windowOutlineSnapToWholePixel()) {
+                outline.penWidth = KDecoration3::snapToPixelGrid(outline.penWidth, scale);
+            }
+        }
+        // the overlap between the thin window outline and behind the window in unscaled pixels.,
+        // and also makes sure that the anti-aliasing blends properly between the window and thin window outline
+        outline.overlap = m_internalSettings->windowOutlineOverlap() ? 0.5 : 0;
+
+        if (!c->isShaded()) {
+            outline.sides = Sides();
             if (!isTopEdge()) {
-                outlineSides |= SideTop;
+                outline.sides |= SideTop;
             }
             if (!isLeftEdge()) {
-                outlineSides |= SideLeft;
+                outline.sides |= SideLeft;
             }
             if (!isBottomEdge()) {
-                outlineSides |= SideBottom;
+                outline.sides |= SideBottom;
             }
             if (!isRightEdge()) {
-                outlineSides |= SideRight;
+                outline.sides |= SideRight;
             }
 
-            if (!c->isShaded()) {
-                Corners outlineCorners;
-
-                if (!isBottomEdge() && !(hasNoBorders() && !m_internalSettings->roundAllCornersWhenNoBorders())) {
-                    if (!isLeftEdge()) {
-                        outlineCorners |= CornerBottomLeft;
-                    }
-                    if (!isRightEdge()) {
-                        outlineCorners |= CornerBottomRight;
-                    }
+            outline.corners = Corners();
+            if (!isBottomEdge() && !(hasNoBorders() && !m_internalSettings->roundAllCornersWhenNoBorders())) {
+                if (!isLeftEdge()) {
+                    outline.corners |= CornerBottomLeft;
                 }
-
-                if (!isTopEdge() && !(hideTitleBar() && hasNoBorders() && !m_internalSettings->roundAllCornersWhenNoBorders())) {
-                    if (!isLeftEdge()) {
-                        outlineCorners |= CornerTopLeft;
-                    }
-                    if (!isRightEdge()) {
-                        outlineCorners |= CornerTopRight;
-                    }
+                if (!isRightEdge()) {
+                    outline.corners |= CornerBottomRight;
                 }
-
-                outlinePath = GeometryTools::roundedPath(outlineRect, outlineCorners, cornerRadius, outlineSides, outlinePenWidth);
-
-            } else {
-                outlinePath.addRoundedRect(outlineRect, cornerRadius, cornerRadius);
             }
 
-            painter.drawPath(outlinePath);
+            if (!isTopEdge() && !(hideTitleBar() && hasNoBorders() && !m_internalSettings->roundAllCornersWhenNoBorders())) {
+                if (!isLeftEdge()) {
+                    outline.corners |= CornerTopLeft;
+                }
+                if (!isRightEdge()) {
+                    outline.corners |= CornerTopRight;
+                }
+            }
         }
     }
-    painter.end();
+
+    const DecorationShadowTexture shadowTexture(DecorationShadowRenderer::render(params, shadowColor, m_scaledCornerRadius, maskCorners, outline));
 
     auto ret = std::make_shared<KDecoration3::DecorationShadow>();
-    ret->setPadding(padding);
-    ret->setInnerShadowRect(QRect(outerRect.center(), QSize(1, 1)));
-    ret->setShadow(shadowTexture);
+    ret->setPadding(shadowTexture.padding);
+    ret->setInnerShadowRect(shadowTexture.innerShadowRect);
+    ret->setShadow(shadowTexture.image);
     return ret;
 }
 
@@ -13,6 +13,7 @@
 #include "breezesettings.h"
 #include "colortools.h"
 #include "decorationcolors.h"
+#include "settingschangetools.h"
 
 #include <KDecoration3/DecoratedWindow>
 #include <KDecoration3/Decoration>
@@ -196,6 +197,7 @@ private Q_SLOTS:
     }
     void generateDecorationColorsOnClientPaletteUpdate(const QPalette &clientPalette);
     void generateDecorationColorsOnDecorationColorSettingsUpdate(QByteArray uuid);
+    void reconfigureOnSettingsChange(QByteArray uuid, SettingsChanges changes);
     void generateDecorationColorsOnSystemColorSettingsUpdate(QByteArray uuid);
     void updateTaskManagerSide(QByteArray uuid = QByteArray());
     void recalculateBorders();
@@ -224,6 +226,7 @@ private:
     QPair<QRectF, Qt::Alignment> captionRect(bool nextState) const;
 
     void reconfigureMain(const bool noUpdateShadow = false);
+    void updateAnimationDurations();
     void updateDecorationColors(const QPalette &clientPalette, QByteArray uuid = "");
     void createButtons();
     void calculateWindowShape();
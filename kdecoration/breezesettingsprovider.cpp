@@ -49,6 +49,12 @@ void SettingsProvider::reconfigure()
 {
     m_defaultSettings->load();
 
+    // presets may have been changed, so are parsed again when next needed
+    m_parsedPresets.clear();
+    if (m_presetsConfig) {
+        m_presetsConfig->reparseConfiguration();
+    }
+
     DecorationExceptionList exceptions;
     exceptions.readConfig(m_config);
     m_exceptions = exceptions.getDefault();
@@ -104,16 +110,12 @@ InternalSettingsPtr SettingsProvider::internalSettings(Decoration *decoration)
                 }
 
                 // load the preset values into internalSettings if a preset is set as an exception
-                PresetsModel::loadPreset(internalSettings.data(), m_presetsConfig.data(), internalSettings->exceptionPreset());
-
-                // if a border size exception is not set then replace it with the KwinBorderSize value from the preset
-                if ((!internalSettings->exceptionBorder())) {
-                    if (PresetsModel::presetHasKwinBorderSizeKey(m_presetsConfig.data(), internalSettings->exceptionPreset())) {
-                        PresetsModel::copyKwinBorderSizeFromPresetToExceptionBorderSize(internalSettings.data(),
-                                                                                        m_presetsConfig.data(),
-                                                                                        internalSettings->exceptionPreset());
-                        internalSettings->setExceptionBorder(true);
-                    }
+                const std::optional<ParsedPreset> &preset(parsedPreset(internalSettings->exceptionPreset()));
+                if (preset) {
+                    PresetsModel::applyPreset(internalSettings.data(), *preset);
+
+                    // if a border size exception is not set then replace it with the KwinBorderSize value from the preset
+                    PresetsModel::applyKwinBorderSizeToException(internalSettings.data(), *preset);
                 }
                 internalSettings->setProperty("noCacheException",
                                               true); // this property is to indicate not to cache shadows or colours for an exception with a Preset
@@ -132,4 +134,14 @@ InternalSettingsPtr SettingsProvider::internalSettings(Decoration *decoration)
 
     return m_defaultSettings;
 }
+
+//__________________________________________________________________
+const std::optional<ParsedPreset> &SettingsProvider::parsedPreset(const QString &presetName)
+{
+    auto it = m_parsedPresets.find(presetName);
+    if (it == m_parsedPresets.end()) {
+        it = m_parsedPresets.insert(presetName, PresetsModel::parsePreset(m_presetsConfig.data(), presetName));
+    }
+    return it.value();
+}
 }
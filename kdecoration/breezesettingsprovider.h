@@ -9,6 +9,7 @@
 #include "breeze.h"
 #include "breezedecoration.h"
 #include "breezesettings.h"
+#include "presetsmodel.h"
 
 #include <KSharedConfig>
 
@@ -37,6 +38,9 @@ public Q_SLOTS:
     void reconfigure();
 
 private:
+    //* parsed preset from m_presetsConfig, parsing it if not yet cached. std::nullopt if the preset is not present
+    const std::optional<ParsedPreset> &parsedPreset(const QString &presetName);
+
     //* constructor
     SettingsProvider();
 
@@ -52,6 +56,9 @@ private:
     //* presets config object
     KSharedConfigPtr m_presetsConfig;
 
+    //* parsed presets used by exceptions, by preset name, so that each is only read once per configuration change
+    QHash<QString, std::optional<ParsedPreset>> m_parsedPresets;
+
     //* singleton
     static SettingsProvider *s_self;
 };
@@ -14,6 +14,8 @@
 #include "plasmatools.h"
 #include "presetsmodel.h"
 #include "renderdecorationbuttonicon.h"
+#include "settingschangetools.h"
+#include "systemicongenerationjob.h"
 
 #include <KLocalizedString>
 
@@ -258,6 +260,12 @@ void ConfigWidget::save()
 
 void ConfigWidget::saveMain(QString saveAsPresetName)
 {
+    // keep the previously saved settings and exceptions, to determine which categories of setting have changed
+    InternalSettings previousSettings;
+    previousSettings.load();
+    DecorationExceptionList previousExceptions;
+    previousExceptions.readConfig(m_configuration);
+
     // create internal settings and load from rc files
     m_internalSettings = InternalSettingsPtr(new InternalSettings());
     m_internalSettings->load();
@@ -317,9 +325,22 @@ void ConfigWidget::saveMain(QString saveAsPresetName)
         m_presetsConfiguration->sync();
     }
 
-    DBusMessages::updateDecorationColorCache();
-    // needed to tell kwin to reload when running from external kcmshell
-    DBusMessages::kwinReloadConfig();
+    // the dialogs save their own settings, so compare against freshly loaded settings
+    InternalSettings savedSettings;
+    savedSettings.load();
+    SettingsChanges changes(SettingsChangeTools::changes(&previousSettings, &savedSettings));
+    changes |= SettingsChangeTools::changes(previousExceptions.getDefault(), defaultExceptions);
+    changes |= SettingsChangeTools::changes(previousExceptions.get(), exceptions);
+
+    if (changes) {
+        DBusMessages::updateDecorationColorCache(changes);
+    }
+
+    // only geometry, icon and exception changes need a full reconfiguration of the decoration
+    if (changes & (SettingsChangeGeometry | SettingsChangeIcons | SettingsChangeExceptions)) {
+        // needed to tell kwin to reload when running from external kcmshell
+        DBusMessages::kwinReloadConfig();
+    }
 
     // not needed as both of the other DBUS messages also update KStyle
     // DBusMessages::kstyleReloadDecorationConfig();
@@ -601,8 +622,8 @@ void ConfigWidget::presetsButtonClicked()
 
 void ConfigWidget::generateSystemIcons()
 {
-    // auto-generate the klassy and klassy-dark system icons in a separate process
-    system("klassy-settings -g &");
+    // auto-generate the klassy and klassy-dark system icons in the background, from the settings just saved
+    g_systemIconGenerationJob.start();
 }
 
 void ConfigWidget::updateIcons()
@@ -573,8 +573,7 @@ void ButtonBehaviour::save(const bool reloadKwinConfig)
     Q_EMIT saved();
 
     if (reloadKwinConfig) {
-        DBusMessages::updateDecorationColorCache();
-        DBusMessages::kwinReloadConfig();
+        DBusMessages::updateDecorationColorCache(SettingsChangeColors);
         // DBusMessages::kstyleReloadDecorationConfig(); //should reload anyway
 
         static_cast<ConfigWidget *>(m_parent)->generateSystemIcons();
@@ -684,8 +684,7 @@ void ButtonColors::save(const bool reloadKwinConfig)
     setChanged(false);
 
     if (reloadKwinConfig) {
-        DBusMessages::updateDecorationColorCache();
-        DBusMessages::kwinReloadConfig();
+        DBusMessages::updateDecorationColorCache(SettingsChangeColors);
         // DBusMessages::kstyleReloadDecorationConfig(); //should reload anyway
         // auto-generate the klassy and klassy-dark system icons
 
@@ -333,6 +333,7 @@ void ButtonSizing::save(const bool reloadKwinConfig)
     setChanged(false);
 
     if (reloadKwinConfig) {
+        DBusMessages::updateDecorationColorCache(SettingsChangeGeometry);
         DBusMessages::kwinReloadConfig();
 
         static_cast<ConfigWidget *>(m_parent)->generateSystemIcons();
@@ -100,8 +100,7 @@ void ShadowStyle::save(const bool reloadKwinConfig)
     setChanged(false);
 
     if (reloadKwinConfig) {
-        DBusMessages::updateDecorationColorCache();
-        DBusMessages::kwinReloadConfig();
+        DBusMessages::updateDecorationColorCache(SettingsChangeShadow);
         // DBusMessages::kstyleReloadDecorationConfig(); //should reload anyway
 
         static_cast<ConfigWidget *>(m_parent)->generateSystemIcons(); // system icons could have a shadow colour override
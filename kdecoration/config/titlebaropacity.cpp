@@ -126,8 +126,7 @@ void TitleBarOpacity::save(const bool reloadKwinConfig)
     setChanged(false);
 
     if (reloadKwinConfig) {
-        DBusMessages::updateDecorationColorCache();
-        DBusMessages::kwinReloadConfig();
+        DBusMessages::updateDecorationColorCache(SettingsChangeColors);
         // DBusMessages::kstyleReloadDecorationConfig(); //should reload anyway
 
         static_cast<ConfigWidget *>(m_parent)->generateSystemIcons();
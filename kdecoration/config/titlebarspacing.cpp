@@ -95,8 +95,10 @@ void TitleBarSpacing::save(const bool reloadKwinConfig)
     m_internalSettings->save();
     setChanged(false);
 
-    if (reloadKwinConfig)
+    if (reloadKwinConfig) {
+        DBusMessages::updateDecorationColorCache(SettingsChangeGeometry);
         DBusMessages::kwinReloadConfig();
+    }
 }
 
 void TitleBarSpacing::defaults()
@@ -168,8 +168,7 @@ void WindowOutlineStyle::save(const bool reloadKwinConfig)
     setChanged(false);
 
     if (reloadKwinConfig) {
-        DBusMessages::updateDecorationColorCache();
-        DBusMessages::kwinReloadConfig();
+        DBusMessages::updateDecorationColorCache(SettingsChangeColors | SettingsChangeShadow);
 
         static_cast<ConfigWidget *>(m_parent)->generateSystemIcons();
     }
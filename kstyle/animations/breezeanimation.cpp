@@ -5,3 +5,143 @@
  */
 
 #include "breezeanimation.h"
+#include "breezeanimationclock.h"
+
+namespace Breeze
+{
+
+//_________________________________________________________________________________
+Animation::Animation(int duration, QObject *parent)
+    : QObject(parent)
+    , _duration(duration)
+{
+}
+
+//_________________________________________________________________________________
+Animation::~Animation()
+{
+    if (_state == Running) {
+        if (auto clock = AnimationClock::self()) {
+            clock->unregisterAnimation(this);
+        }
+    }
+}
+
+//_________________________________________________________________________________
+void Animation::setTargetObject(QObject *target)
+{
+    _target = target;
+    updateProperty();
+}
+
+//_________________________________________________________________________________
+void Animation::setPropertyName(const QByteArray &propertyName)
+{
+    _propertyName = propertyName;
+    updateProperty();
+}
+
+//_________________________________________________________________________________
+void Animation::start()
+{
+    if (_state == Running) {
+        return;
+    }
+
+    _currentLoop = 0;
+    _currentTime = (_direction == Forward) ? 0 : _duration;
+    _state = Running;
+    updateCurrentValue();
+
+    // nothing to animate, or clock already gone during application shutdown: jump to the end
+    auto clock = AnimationClock::self();
+    if ((_duration <= 0 && _loopCount >= 0) || !clock) {
+        _currentTime = (_direction == Forward) ? _duration : 0;
+        updateCurrentValue();
+        _state = Stopped;
+        Q_EMIT finished();
+        return;
+    }
+
+    clock->registerAnimation(this);
+}
+
+//_________________________________________________________________________________
+void Animation::stop()
+{
+    if (_state == Stopped) {
+        return;
+    }
+
+    _state = Stopped;
+    if (auto clock = AnimationClock::self()) {
+        clock->unregisterAnimation(this);
+    }
+}
+
+//_________________________________________________________________________________
+void Animation::advance(int elapsed)
+{
+    const bool forward(_direction == Forward);
+    _currentTime += forward ? elapsed : -elapsed;
+
+    bool done(false);
+    if (forward && _currentTime >= _duration) {
+        if (_loopCount < 0 || ++_currentLoop < _loopCount) {
+            _currentTime = (_duration > 0) ? _currentTime % _duration : 0;
+        } else {
+            _currentTime = _duration;
+            done = true;
+        }
+
+    } else if (!forward && _currentTime <= 0) {
+        if (_loopCount < 0 || ++_currentLoop < _loopCount) {
+            _currentTime = (_duration > 0) ? _duration + _currentTime % _duration : 0;
+        } else {
+            _currentTime = 0;
+            done = true;
+        }
+    }
+
+    updateCurrentValue();
+
+    if (done) {
+        stop();
+        Q_EMIT finished();
+    }
+}
+
+//_________________________________________________________________________________
+void Animation::updateCurrentValue()
+{
+    if (!(_target && _property.isValid())) {
+        return;
+    }
+
+    // linear interpolation, as done by QPropertyAnimation with default easing curve
+    const qreal progress((_duration > 0) ? qreal(_currentTime) / _duration : 1.0);
+    const qreal startValue(_startValue.toReal());
+    const qreal value(startValue + (_endValue.toReal() - startValue) * progress);
+
+    if (_property.userType() == QMetaType::Int) {
+        _property.write(_target.data(), int(value));
+    } else {
+        _property.write(_target.data(), value);
+    }
+}
+
+//_________________________________________________________________________________
+void Animation::updateProperty()
+{
+    _property = QMetaProperty();
+    if (!_target || _propertyName.isEmpty()) {
+        return;
+    }
+
+    const QMetaObject *metaObject(_target.data()->metaObject());
+    const int index(metaObject->indexOfProperty(_propertyName.constData()));
+    if (index >= 0) {
+        _property = metaObject->property(index);
+    }
+}
+}
@@ -8,13 +8,21 @@
 
 #include "breeze.h"
 
-#include <QPropertyAnimation>
+#include <QByteArray>
+#include <QMetaProperty>
+#include <QObject>
 #include <QVariant>
 
 namespace Breeze
 {
 
-class Animation : public QPropertyAnimation
+//* property animation, driven by the shared AnimationClock
+/**
+it mimics the subset of the QPropertyAnimation API used by the engines,
+but does not own a timer: all running animations are advanced together,
+once per frame, by AnimationClock
+*/
+class Animation : public QObject
 {
     Q_OBJECT
 
@@ -22,19 +30,102 @@ public:
     //* convenience
     using Pointer = WeakPointer<Animation>;
 
+    //* direction
+    enum Direction {
+        Forward,
+        Backward,
+    };
+
+    //* state
+    enum State {
+        Stopped,
+        Running,
+    };
+
     //* constructor
-    Animation(int duration, QObject *parent)
-        : QPropertyAnimation(parent)
+    Animation(int duration, QObject *parent);
+
+    //* destructor
+    ~Animation() override;
+
+    //*@name accessors
+    //@{
+
+    //* duration
+    [[nodiscard]] int duration() const
     {
-        setDuration(duration);
+        return _duration;
+    }
+
+    //* direction
+    [[nodiscard]] Direction direction() const
+    {
+        return _direction;
+    }
+
+    //* state
+    [[nodiscard]] State state() const
+    {
+        return _state;
     }
 
     //* true if running
     [[nodiscard]] bool isRunning() const
     {
-        return state() == Animation::Running;
+        return _state == Running;
+    }
+
+    //@}
+
+    //*@name modifiers
+    //@{
+
+    //* duration
+    void setDuration(int value)
+    {
+        _duration = value;
     }
 
+    //* direction
+    void setDirection(Direction value)
+    {
+        _direction = value;
+    }
+
+    //* loop count. Negative value loops until stopped
+    void setLoopCount(int value)
+    {
+        _loopCount = value;
+    }
+
+    //* start value
+    void setStartValue(const QVariant &value)
+    {
+        _startValue = value;
+    }
+
+    //* end value
+    void setEndValue(const QVariant &value)
+    {
+        _endValue = value;
+    }
+
+    //* target object
+    void setTargetObject(QObject *);
+
+    //* property name
+    void setPropertyName(const QByteArray &);
+
+    //@}
+
+public Q_SLOTS:
+
+    //* start
+    void start();
+
+    //* stop
+    void stop();
+
     //* restart
     void restart()
     {
@@ -43,5 +134,55 @@ public:
         }
         start();
     }
+
+Q_SIGNALS:
+
+    //* emitted when the animation reaches its end
+    void finished();
+
+private:
+    friend class AnimationClock;
+
+    //* advance current time by given amount of milliseconds. Called by AnimationClock
+    void advance(int elapsed);
+
+    //* write interpolated value to target property
+    void updateCurrentValue();
+
+    //* resolve target property
+    void updateProperty();
+
+    //* duration
+    int _duration = 0;
+
+    //* direction
+    Direction _direction = Forward;
+
+    //* state
+    State _state = Stopped;
+
+    //* loop count
+    int _loopCount = 1;
+
+    //* current loop
+    int _currentLoop = 0;
+
+    //* current time
+    int _currentTime = 0;
+
+    //* start value
+    QVariant _startValue;
+
+    //* end value
+    QVariant _endValue;
+
+    //* target object
+    WeakPointer<QObject> _target;
+
+    //* property name
+    QByteArray _propertyName;
+
+    //* resolved target property
+    QMetaProperty _property;
 };
 }
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezeanimationclock.h"
+#include "breezeanimation.h"
+
+#include <QAbstractAnimation>
+
+#include <algorithm>
+#include <utility>
+
+namespace Breeze
+{
+
+//* never ending animation, used to get one callback per frame from Qt's animation timer
+class AnimationClockDriver : public QAbstractAnimation
+{
+public:
+    //* constructor
+    explicit AnimationClockDriver(AnimationClock *clock)
+        : QAbstractAnimation(clock)
+        , _clock(clock)
+    {
+    }
+
+    //* duration
+    int duration() const override
+    {
+        return -1;
+    }
+
+protected:
+    //* time update
+    void updateCurrentTime(int time) override
+    {
+        _clock->tick(time);
+    }
+
+private:
+    //* clock
+    AnimationClock *_clock;
+};
+
+Q_GLOBAL_STATIC(AnimationClock, s_animationClock)
+
+//_________________________________________________________________________________
+AnimationClock::AnimationClock()
+    : QObject()
+    , _driver(new AnimationClockDriver(this))
+{
+}
+
+//_________________________________________________________________________________
+AnimationClock::~AnimationClock()
+{
+    _driver->stop();
+}
+
+//_________________________________________________________________________________
+AnimationClock *AnimationClock::self()
+{
+    return s_animationClock.isDestroyed() ? nullptr : s_animationClock();
+}
+
+//_________________________________________________________________________________
+void AnimationClock::update(QWidget *widget)
+{
+    auto clock = self();
+    if (!(clock && clock->_ticking)) {
+        widget->update();
+        return;
+    }
+
+    if (std::find(clock->_dirtyWidgets.cbegin(), clock->_dirtyWidgets.cend(), widget) == clock->_dirtyWidgets.cend()) {
+        clock->_dirtyWidgets.emplace_back(widget);
+    }
+}
+
+//_________________________________________________________________________________
+void AnimationClock::registerAnimation(Animation *animation)
+{
+    if (_driver->state() != QAbstractAnimation::Running) {
+        _driver->start();
+    }
+
+    _records.push_back({animation, _driver->currentTime()});
+    _peakAnimationCount = qMax(_peakAnimationCount, ++_activeAnimationCount);
+}
+
+//_________________________________________________________________________________
+void AnimationClock::unregisterAnimation(Animation *animation)
+{
+    const auto iter = std::find_if(_records.begin(), _records.end(), [animation](const Record &record) {
+        return record.animation == animation;
+    });
+
+    if (iter == _records.end()) {
+        return;
+    }
+
+    --_activeAnimationCount;
+
+    // records are only compacted at the end of a tick, to keep indices valid while iterating
+    if (_ticking) {
+        iter->animation = nullptr;
+    } else {
+        _records.erase(iter);
+        if (_records.empty()) {
+            _driver->stop();
+        }
+    }
+}
+
+//_________________________________________________________________________________
+void AnimationClock::tick(int time)
+{
+    ++_tickCount;
+    _ticking = true;
+
+    // animations may be started or stopped from within property setters and finished() slots,
+    // so iterate by index and re-read the record every time
+    for (std::size_t i = 0; i < _records.size(); ++i) {
+        Animation *animation = _records[i].animation;
+        if (!animation) {
+            continue;
+        }
+
+        const int elapsed(time - _records[i].lastTime);
+        _records[i].lastTime = time;
+        animation->advance(elapsed);
+    }
+
+    _ticking = false;
+
+    std::erase_if(_records, [](const Record &record) {
+        return !record.animation;
+    });
+
+    // coalesced repaints
+    const auto dirtyWidgets = std::exchange(_dirtyWidgets, {});
+    for (const auto &widget : dirtyWidgets) {
+        if (widget) {
+            widget->update();
+        }
+    }
+
+    if (_records.empty()) {
+        _driver->stop();
+    }
+}
+}
@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include "breeze.h"
+
+#include <QObject>
+#include <QWidget>
+
+#include <vector>
+
+class QAbstractAnimation;
+
+namespace Breeze
+{
+
+class Animation;
+
+//* engine-wide animation driver
+/**
+a single clock, synchronized with Qt's animation timer, ticks once per frame while
+at least one Animation is running. All running animations are stored in a contiguous
+array and advanced in one pass, and widget repaints requested during the pass are
+coalesced into a single update() per widget
+*/
+class AnimationClock : public QObject
+{
+    Q_OBJECT
+
+public:
+    //* constructor
+    explicit AnimationClock();
+
+    //* destructor
+    ~AnimationClock() override;
+
+    //* shared instance. Returns nullptr once destroyed on application exit
+    static AnimationClock *self();
+
+    //* schedule a repaint of given widget
+    /** the repaint is deferred to the end of the current tick, if any, or triggered immediately otherwise */
+    static void update(QWidget *);
+
+    //* number of running animations
+    [[nodiscard]] int activeAnimationCount() const
+    {
+        return _activeAnimationCount;
+    }
+
+    //* largest number of animations running simultaneously so far
+    [[nodiscard]] int peakAnimationCount() const
+    {
+        return _peakAnimationCount;
+    }
+
+    //* number of ticks so far
+    [[nodiscard]] quint64 tickCount() const
+    {
+        return _tickCount;
+    }
+
+protected:
+    friend class Animation;
+
+    //* add running animation
+    void registerAnimation(Animation *);
+
+    //* remove animation
+    void unregisterAnimation(Animation *);
+
+private:
+    friend class AnimationClockDriver;
+
+    //* advance all running animations to given clock time
+    void tick(int time);
+
+    //* running animation record
+    struct Record {
+        Animation *animation = nullptr;
+        int lastTime = 0;
+    };
+
+    //* running animations
+    std::vector<Record> _records;
+
+    //* widgets to be repainted at the end of current tick
+    std::vector<QPointer<QWidget>> _dirtyWidgets;
+
+    //* driver, hooked to Qt's animation timer
+    QAbstractAnimation *_driver = nullptr;
+
+    //* true while advancing animations
+    bool _ticking = false;
+
+    //*@name debug counters
+    //@{
+    int _activeAnimationCount = 0;
+    int _peakAnimationCount = 0;
+    quint64 _tickCount = 0;
+    //@}
+};
+}
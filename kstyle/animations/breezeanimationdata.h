@@ -8,6 +8,7 @@
 #include "config-breeze.h"
 
 #include "breezeanimation.h"
+#include "breezeanimationclock.h"
 
 #if BREEZE_HAVE_QTQUICK
 #include <QQuickItem>
@@ -83,7 +84,7 @@ protected:
     virtual void setDirty() const
     {
         if (auto widget = qobject_cast<QWidget *>(_target)) {
-            widget->update();
+            AnimationClock::update(widget);
         }
 #if BREEZE_HAVE_QTQUICK
         else if (auto item = qobject_cast<QQuickItem *>(_target)) {
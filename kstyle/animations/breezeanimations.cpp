@@ -12,13 +12,16 @@
 #include <QCheckBox>
 #include <QComboBox>
 #include <QDial>
+#include <QEvent>
 #include <QGroupBox>
 #include <QHeaderView>
 #include <QLineEdit>
+#include <QPointer>
 #include <QProgressBar>
 #include <QRadioButton>
 #include <QScrollBar>
 #include <QSpinBox>
+#include <QStackedWidget>
 #include <QTextEdit>
 #include <QToolBox>
 #include <QToolButton>
@@ -51,6 +54,7 @@ void Animations::setupEngines()
 {
     // animation steps
     AnimationData::setSteps(StyleConfigData::animationSteps());
+    TransitionWidget::setMaxArea(StyleConfigData::stackedWidgetTransitionsMaxArea());
 
     const bool animationsEnabled(StyleConfigData::animationsEnabled());
     const int animationsDuration(StyleConfigData::animationsDuration());
@@ -83,7 +87,7 @@ void Animations::setupEngines()
 }
 
 //____________________________________________________________
-void Animations::registerWidget(QObject *widget) const
+void Animations::registerWidget(QObject *widget)
 {
     if (!widget) {
         return;
@@ -95,21 +99,78 @@ void Animations::registerWidget(QObject *widget) const
         return;
     }
 
+    // KQuickStyleItem. These are not guaranteed to receive hover events, so they are registered immediately
+    if (!widget->isWidgetType()) {
+        _widgetEnabilityEngine->registerWidget(widget, AnimationEnable);
+
+        const QString elementType = widget->property("elementType").toString();
+        if (!elementType.isEmpty()) {
+            if (elementType == QLatin1String("checkbox") || elementType == QLatin1String("radiobutton")) {
+                _widgetStateEngine->registerWidget(widget, AnimationHover | AnimationFocus | AnimationPressed);
+            }
+        }
+        return;
+    }
+
+    // progress bars and stacked widgets animate without user interaction, so they are registered immediately
+    if (qobject_cast<QProgressBar *>(widget) || qobject_cast<QStackedWidget *>(widget)) {
+        registerEngines(widget);
+        return;
+    }
+
+    // other widgets only get animation data the first time they are interacted with
+    widget->installEventFilter(this);
+}
+
+//____________________________________________________________
+bool Animations::eventFilter(QObject *object, QEvent *event)
+{
+    switch (event->type()) {
+    case QEvent::Enter:
+    case QEvent::Leave:
+    case QEvent::HoverEnter:
+    case QEvent::FocusIn:
+    case QEvent::FocusOut:
+    case QEvent::MouseButtonPress:
+    case QEvent::EnabledChange:
+        break;
+
+    default:
+        return false;
+    }
+
+    object->removeEventFilter(this);
+
+    // the engines install their own event filters on the widget, which would shift its filter list while this event is being dispatched,
+    // so registration is deferred to the event loop. The states the widget was in before this event are recorded now
+    const InitialStates states(initialStates(object, event));
+    QPointer<QObject> guard(object);
+    QMetaObject::invokeMethod(
+        this,
+        [this, guard, states]() {
+            if (!guard) {
+                return;
+            }
+            registerEngines(guard.data());
+            initializeStates(guard.data(), states);
+
+            // in case the widget was painted before its animation data existed
+            static_cast<QWidget *>(guard.data())->update();
+        },
+        Qt::QueuedConnection);
+
+    return false;
+}
+
+//____________________________________________________________
+void Animations::registerEngines(QObject *widget) const
+{
     // all widgets are registered to the enability engine.
     _widgetEnabilityEngine->registerWidget(widget, AnimationEnable);
 
     // install animation timers
     // for optimization, one should put with most used widgets here first
 
-    // KQuickStyleItem.
-    const QString elementType = widget->property("elementType").toString();
-    if (!elementType.isEmpty()) {
-        if (elementType == QLatin1String("checkbox") || elementType == QLatin1String("radiobutton")) {
-            _widgetStateEngine->registerWidget(widget, AnimationHover | AnimationFocus | AnimationPressed);
-        }
-        return;
-    }
-
     // buttons
     if (auto toolButton = qobject_cast<QToolButton *>(widget)) {
         _toolButtonEngine->registerWidget(toolButton, AnimationHover | AnimationFocus);
@@ -200,12 +261,56 @@ void Animations::registerWidget(QObject *widget) const
 }
 
 //____________________________________________________________
-void Animations::unregisterWidget(QObject *widget) const
+Animations::InitialStates Animations::initialStates(QObject *object, QEvent *event) const
+{
+    auto widget = static_cast<QWidget *>(object);
+
+    // data created from an event filter have no history, so initialize them with the state
+    // the widget was in before the event, for the paint that follows to animate the transition
+    const QEvent::Type type(event->type());
+    InitialStates states;
+    states.hovered = (type == QEvent::Enter || type == QEvent::HoverEnter) ? false : (type == QEvent::Leave) ? true : widget->underMouse();
+    states.focused = (type == QEvent::FocusIn) ? false : (type == QEvent::FocusOut) ? true : widget->hasFocus();
+    states.enabled = widget->isEnabled();
+    states.enabledChanged = (type == QEvent::EnabledChange);
+    return states;
+}
+
+//____________________________________________________________
+void Animations::initializeStates(QObject *object, const InitialStates &states) const
+{
+    auto widget = static_cast<QWidget *>(object);
+    const bool hovered(states.hovered);
+    const bool focused(states.focused);
+
+    for (WidgetStateEngine *engine : {_widgetStateEngine, _inputWidgetEngine}) {
+        engine->updateState(widget, AnimationHover, hovered);
+        engine->updateState(widget, AnimationFocus, focused);
+        engine->updateState(widget, AnimationPressed, false);
+    }
+
+    // sub-control hover
+    _toolButtonEngine->updateState(widget, AnimationHover, false);
+    _toolButtonEngine->updateState(widget, AnimationFocus, focused);
+    _comboBoxEngine->updateState(widget, AnimationHover, false);
+
+    // enability. The enable data filter is installed too late to see the triggering event, so animate here
+    if (states.enabledChanged) {
+        _widgetEnabilityEngine->updateState(widget, AnimationEnable, !states.enabled);
+    }
+    _widgetEnabilityEngine->updateState(widget, AnimationEnable, states.enabled);
+}
+
+//____________________________________________________________
+void Animations::unregisterWidget(QObject *widget)
 {
     if (!widget) {
         return;
     }
 
+    // widget might still be waiting for its first interaction
+    widget->removeEventFilter(this);
+
     _widgetEnabilityEngine->unregisterWidget(widget);
     _spinBoxEngine->unregisterWidget(widget);
     _comboBoxEngine->unregisterWidget(widget);
@@ -31,10 +31,17 @@ public:
     explicit Animations();
 
     //* register animations corresponding to given widget, depending on its type.
-    void registerWidget(QObject *widget) const;
+    /**
+    for most widgets the animation data are only created upon first hover, focus
+    or enability change, so that widgets that are never interacted with stay cheap
+    */
+    void registerWidget(QObject *widget);
 
     /** unregister all animations associated to a widget */
-    void unregisterWidget(QObject *widget) const;
+    void unregisterWidget(QObject *widget);
+
+    //* event filter, used for lazy registration
+    bool eventFilter(QObject *, QEvent *) override;
 
     //* enability engine
     [[nodiscard]] WidgetStateEngine &widgetEnabilityEngine() const
@@ -120,6 +127,23 @@ private:
     //* register new engine
     void registerEngine(BaseEngine *);
 
+    //* register widget to the engines relevant to its type
+    void registerEngines(QObject *widget) const;
+
+    //* widget states before the event that triggered the registration
+    struct InitialStates {
+        bool hovered = false;
+        bool focused = false;
+        bool enabled = true;
+        bool enabledChanged = false;
+    };
+
+    //* states of a widget before the given event
+    InitialStates initialStates(QObject *widget, QEvent *event) const;
+
+    //* initialize freshly registered widget states from the states before the event that triggered the registration
+    void initializeStates(QObject *widget, const InitialStates &states) const;
+
     //* busy indicator
     BusyIndicatorEngine *_busyIndicatorEngine = nullptr;
 
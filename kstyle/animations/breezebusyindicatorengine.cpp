@@ -8,10 +8,12 @@
 
 #include "breezebusyindicatorengine.h"
 
+#include "breezeanimationclock.h"
 #include "breezemetrics.h"
 
 #if BREEZE_HAVE_QTQUICK
 #include <QQuickItem>
+#include <QQuickWindow>
 #endif
 
 #include <QVariant>
@@ -125,18 +127,24 @@ void BusyIndicatorEngine::setValue(int value)
     // loop over objects in map
     for (DataMap<BusyIndicatorData>::iterator iter = _data.begin(); iter != _data.end(); ++iter) {
         if (iter.value().data()->isAnimated()) {
-            // update animation flag
-            animated = true;
-
             const void *key = iter.key();
             QObject *obj = const_cast<QObject *>(static_cast<const QObject *>(key));
+
+            // hidden progress bars are not updated, and do not keep the animation alive.
+            // It is restarted from the paint event once they are shown again
 #if BREEZE_HAVE_QTQUICK
             if (QQuickItem *item = qobject_cast<QQuickItem *>(obj)) {
-                item->polish();
+                if (item->isVisible() && item->window() && item->window()->isVisible()) {
+                    animated = true;
+                    item->polish();
+                }
             } else
 #endif
                 if (QWidget *widget = qobject_cast<QWidget *>(obj)) {
-                widget->update();
+                if (widget->isVisible() && !widget->window()->isMinimized()) {
+                    animated = true;
+                    AnimationClock::update(widget);
+                }
             }
         }
     }
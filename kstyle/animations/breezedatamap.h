@@ -8,49 +8,171 @@
 
 #include "breeze.h"
 
-#include <QMap>
 #include <QObject>
 #include <QPaintDevice>
 
+#include <utility>
+#include <vector>
+
 namespace Breeze
 {
 
 //* data map
-/** it maps an opaque pointer an associated QPointer<object> */
+/**
+it maps an opaque pointer an associated QPointer<object>.
+Storage is an open-addressing hash table with linear probing, so that
+lookups from the paint path are O(1) regardless of the number of registered widgets
+*/
 template<typename T>
-class DataMap : public QMap<const void *, WeakPointer<T>>
+class DataMap
 {
 public:
     using Key = const void *;
     using Value = WeakPointer<T>;
 
+private:
+    //* hash bucket. A null key marks an empty bucket
+    struct Bucket {
+        Key key = nullptr;
+        Value value;
+    };
+
+public:
+    //* iterator over occupied buckets
+    class iterator
+    {
+    public:
+        //* constructor
+        iterator(Bucket *bucket, Bucket *end)
+            : _bucket(bucket)
+            , _end(end)
+        {
+            skipEmpty();
+        }
+
+        //* key
+        Key key() const
+        {
+            return _bucket->key;
+        }
+
+        //* value
+        Value &value() const
+        {
+            return _bucket->value;
+        }
+
+        //* value
+        Value &operator*() const
+        {
+            return _bucket->value;
+        }
+
+        //* increment
+        iterator &operator++()
+        {
+            ++_bucket;
+            skipEmpty();
+            return *this;
+        }
+
+        //* equality
+        bool operator==(const iterator &other) const
+        {
+            return _bucket == other._bucket;
+        }
+
+        //* inequality
+        bool operator!=(const iterator &other) const
+        {
+            return _bucket != other._bucket;
+        }
+
+    private:
+        //* move to the next occupied bucket
+        void skipEmpty()
+        {
+            while (_bucket != _end && !_bucket->key) {
+                ++_bucket;
+            }
+        }
+
+        Bucket *_bucket;
+        Bucket *_end;
+    };
+
+    //*@name iterators
+    //@{
+
+    iterator begin()
+    {
+        return iterator(_buckets.data(), _buckets.data() + _buckets.size());
+    }
+
+    iterator end()
+    {
+        return iterator(_buckets.data() + _buckets.size(), _buckets.data() + _buckets.size());
+    }
+
+    //@}
+
+    //* number of registered keys
+    int size() const
+    {
+        return int(_size);
+    }
+
+    //* true if no key is registered
+    bool isEmpty() const
+    {
+        return _size == 0;
+    }
+
+    //* true if key is registered
+    bool contains(Key key) const
+    {
+        return key && indexOf(key) >= 0;
+    }
+
     //* insertion
-    typename QMap<Key, Value>::iterator insert(const Key &key, const Value &value, bool enabled = true)
+    iterator insert(const Key &key, const Value &value, bool enabled = true)
     {
+        if (!key) {
+            return end();
+        }
+
         if (value) {
             value.data()->setEnabled(enabled);
         }
-        return QMap<Key, Value>::insert(key, value);
+
+        // keep load factor below one half
+        if ((_size + 1) * 2 > _buckets.size()) {
+            rehash(_buckets.empty() ? MinimumCapacity : _buckets.size() * 2);
+        }
+
+        std::size_t index(hash(key) & mask());
+        while (_buckets[index].key && _buckets[index].key != key) {
+            index = (index + 1) & mask();
+        }
+
+        if (!_buckets[index].key) {
+            _buckets[index].key = key;
+            ++_size;
+        }
+        _buckets[index].value = value;
+
+        return iterator(_buckets.data() + index, _buckets.data() + _buckets.size());
     }
 
     //* find value
-    Value find(Key key)
+    Value find(Key key) const
     {
         if (!(enabled() && key)) {
             return Value();
         }
-        if (key == _lastKey) {
-            return _lastValue;
-        } else {
-            Value out;
-            typename QMap<Key, Value>::iterator iter(QMap<Key, Value>::find(key));
-            if (iter != QMap<Key, Value>::end()) {
-                out = iter.value();
-            }
-            _lastKey = key;
-            _lastValue = out;
-            return out;
-        }
+
+        const int index(indexOf(key));
+        return index >= 0 ? _buckets[index].value : Value();
     }
 
     //* unregister widget
@@ -61,25 +183,17 @@ public:
             return false;
         }
 
-        // clear last value if needed
-        if (key == _lastKey) {
-            if (_lastValue) {
-                _lastValue.clear();
-            }
-            _lastKey = nullptr;
-        }
-
         // find key in map
-        typename QMap<Key, Value>::iterator iter(QMap<Key, Value>::find(key));
-        if (iter == QMap<Key, Value>::end()) {
+        const int index(indexOf(key));
+        if (index < 0) {
             return false;
         }
 
         // delete value from map if found
-        if (iter.value()) {
-            iter.value().data()->deleteLater();
+        if (_buckets[index].value) {
+            _buckets[index].value.data()->deleteLater();
         }
-        QMap<Key, Value>::erase(iter);
+        erase(index);
 
         return true;
     }
@@ -88,9 +202,9 @@ public:
     void setEnabled(bool enabled)
     {
         _enabled = enabled;
-        for (const Value &value : std::as_const(*this)) {
-            if (value) {
-                value.data()->setEnabled(enabled);
+        for (const Bucket &bucket : _buckets) {
+            if (bucket.key && bucket.value) {
+                bucket.value.data()->setEnabled(enabled);
             }
         }
     }
@@ -104,21 +218,100 @@ public:
     //* duration
     void setDuration(int duration) const
     {
-        for (const Value &value : std::as_const(*this)) {
-            if (value) {
-                value.data()->setDuration(duration);
+        for (const Bucket &bucket : _buckets) {
+            if (bucket.key && bucket.value) {
+                bucket.value.data()->setDuration(duration);
             }
         }
     }
 
 private:
-    //* enability
-    bool _enabled = true;
+    //* initial number of buckets. Must be a power of two
+    static constexpr std::size_t MinimumCapacity = 16;
 
-    //* last key
-    Key _lastKey = nullptr;
+    //* pointer hash. Widget addresses are aligned, so mix high bits into the low ones
+    static std::size_t hash(Key key)
+    {
+        quint64 value(reinterpret_cast<quintptr>(key));
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        return std::size_t(value);
+    }
+
+    //* bucket mask
+    std::size_t mask() const
+    {
+        return _buckets.size() - 1;
+    }
+
+    //* bucket index for given key, -1 if not found
+    int indexOf(Key key) const
+    {
+        if (_buckets.empty()) {
+            return -1;
+        }
+
+        std::size_t index(hash(key) & mask());
+        while (_buckets[index].key) {
+            if (_buckets[index].key == key) {
+                return int(index);
+            }
+            index = (index + 1) & mask();
+        }
 
-    //* last value
-    Value _lastValue;
+        return -1;
+    }
+
+    //* remove bucket, shifting subsequent entries of the probe sequence back so that no tombstone is needed
+    void erase(std::size_t index)
+    {
+        std::size_t next(index);
+        while (true) {
+            next = (next + 1) & mask();
+            if (!_buckets[next].key) {
+                break;
+            }
+
+            // move entry back unless its ideal position lies cyclically in (index, next]
+            const std::size_t ideal(hash(_buckets[next].key) & mask());
+            const bool inRange = (index <= next) ? (index < ideal && ideal <= next) : (index < ideal || ideal <= next);
+            if (!inRange) {
+                _buckets[index] = std::move(_buckets[next]);
+                index = next;
+            }
+        }
+
+        _buckets[index] = Bucket();
+        --_size;
+    }
+
+    //* resize bucket array
+    void rehash(std::size_t capacity)
+    {
+        std::vector<Bucket> buckets(capacity);
+        std::swap(buckets, _buckets);
+
+        for (Bucket &bucket : buckets) {
+            if (!bucket.key) {
+                continue;
+            }
+
+            std::size_t index(hash(bucket.key) & mask());
+            while (_buckets[index].key) {
+                index = (index + 1) & mask();
+            }
+            _buckets[index] = std::move(bucket);
+        }
+    }
+
+    //* buckets
+    std::vector<Bucket> _buckets;
+
+    //* number of occupied buckets
+    std::size_t _size = 0;
+
+    //* enability
+    bool _enabled = true;
 };
 }
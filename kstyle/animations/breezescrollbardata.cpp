@@ -26,8 +26,8 @@ ScrollBarData::ScrollBarData(QObject *parent, QObject *target, int duration)
     _subLineData._animation = new Animation(duration, this);
     _grooveData._animation = new Animation(duration, this);
 
-    connect(addLineAnimation().data(), &QAbstractAnimation::finished, this, &ScrollBarData::clearAddLineRect);
-    connect(subLineAnimation().data(), &QAbstractAnimation::finished, this, &ScrollBarData::clearSubLineRect);
+    connect(addLineAnimation().data(), &Animation::finished, this, &ScrollBarData::clearAddLineRect);
+    connect(subLineAnimation().data(), &Animation::finished, this, &ScrollBarData::clearSubLineRect);
 
     // setup animation
     setupAnimation(addLineAnimation(), "addLineOpacity");
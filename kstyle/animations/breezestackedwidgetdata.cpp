@@ -25,7 +25,9 @@ StackedWidgetData::StackedWidgetData(QObject *parent, QStackedWidget *target, in
 
     // disable focus
     transition().data()->setAttribute(Qt::WA_NoMousePropagation, true);
-    transition().data()->setFlag(TransitionWidget::PaintOnWidget, true);
+
+    // grab start pixmap from the last painted frame rather than re-rendering the parent chain
+    transition().data()->setFlag(TransitionWidget::GrabFromBackingStore, true);
 
     setMaxRenderTime(50);
 }
@@ -51,7 +53,15 @@ bool StackedWidgetData::initializeAnimation()
     }
 
     // get old widget (matching _index) and initialize transition
-    if (QWidget *widget = _target.data()->widget(_index)) {
+    QWidget *widget = _target.data()->widget(_index);
+
+    // skip transition for widgets too large to be grabbed and blended efficiently
+    if (widget && transition().data()->exceedsMaxArea(widget->size())) {
+        _index = _target.data()->currentIndex();
+        return false;
+    }
+
+    if (widget) {
         transition().data()->setOpacity(0);
         startClock();
         transition().data()->setGeometry(widget->geometry());
@@ -9,15 +9,39 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "breezetransitionwidget.h"
+#include "breezepropertynames.h"
 
+#include <QBackingStore>
+#include <QImage>
 #include <QPaintEvent>
 #include <QPainter>
 #include <QStyleOption>
 #include <QTextStream>
+#include <QWindow>
+
+#include <algorithm>
 
 namespace Breeze
 {
 
+namespace
+{
+//* true if the widget or one of its children renders to a texture that is composed on top of the backing store
+bool hasTextureChildren(const QWidget *widget)
+{
+    const auto isTextureWidget([](const QWidget *child) {
+        return child->inherits("QOpenGLWidget") || child->inherits("QQuickWidget") || child->inherits("QRhiWidget");
+    });
+
+    if (isTextureWidget(widget)) {
+        return true;
+    }
+
+    const auto children(widget->findChildren<QWidget *>());
+    return std::any_of(children.cbegin(), children.cend(), isTextureWidget);
+}
+}
+
 //________________________________________________
 bool TransitionWidget::_paintEnabled = true;
 bool TransitionWidget::paintEnabled()
@@ -26,6 +50,7 @@ bool TransitionWidget::paintEnabled()
 }
 
 int TransitionWidget::_steps = 0;
+int TransitionWidget::_maxArea = 0;
 
 //________________________________________________
 TransitionWidget::TransitionWidget(QWidget *parent, int duration)
@@ -43,7 +68,7 @@ TransitionWidget::TransitionWidget(QWidget *parent, int duration)
     _animation.data()->setPropertyName("opacity");
 
     // hide when animation is finished
-    connect(_animation.data(), &QAbstractAnimation::finished, this, &QWidget::hide);
+    connect(_animation.data(), &Animation::finished, this, &QWidget::hide);
 }
 
 //________________________________________________
@@ -67,7 +92,7 @@ QPixmap TransitionWidget::grab(QWidget *widget, QRect rect)
         widget = widget->window();
         out = widget->grab(rect);
 
-    } else {
+    } else if (!(testFlag(GrabFromBackingStore) && !testFlag(Transparent) && grabFromBackingStore(out, widget, rect))) {
         if (!testFlag(Transparent)) {
             grabBackground(out, widget, rect);
         }
@@ -108,74 +133,26 @@ void TransitionWidget::paintEvent(QPaintEvent *event)
         return;
     }
 
-    // get rect
-    QRect rect = event->rect();
-    if (!rect.isValid()) {
-        rect = this->rect();
-    }
+    // blend start and end pixmaps directly on the widget, in a single pass
+    QPainter p(this);
+    p.setClipRect(event->rect());
 
-    // local pixmap
-    const bool paintOnWidget(testFlag(PaintOnWidget) && !testFlag(Transparent));
-    if (!paintOnWidget) {
-        if (_currentPixmap.isNull() || _currentPixmap.size() != size()) {
-            _currentPixmap = QPixmap(size());
+    // draw end pixmap first, provided that opacity is large enough
+    // it is faded only if parent target is transparent
+    if (opacity() >= 0.004 && !_endPixmap.isNull()) {
+        if (opacity() <= 0.996 && testFlag(Transparent)) {
+            p.setOpacity(opacity());
         }
+        p.drawPixmap(QPoint(), _endPixmap);
+        p.setOpacity(1.0);
     }
 
-    // fill
-    _currentPixmap.fill(Qt::transparent);
-
-    // copy local pixmap to current
-    {
-        QPainter p;
-
-        // draw end pixmap first, provided that opacity is small enough
-        if (opacity() >= 0.004 && !_endPixmap.isNull()) {
-            // faded endPixmap if parent target is transparent and opacity is
-            if (opacity() <= 0.996 && testFlag(Transparent)) {
-                fade(_endPixmap, _currentPixmap, opacity(), rect);
-                p.begin(&_currentPixmap);
-                p.setClipRect(event->rect());
-
-            } else {
-                if (paintOnWidget) {
-                    p.begin(this);
-                } else {
-                    p.begin(&_currentPixmap);
-                }
-                p.setClipRect(event->rect());
-                p.drawPixmap(QPoint(), _endPixmap);
-            }
-
-        } else {
-            if (paintOnWidget) {
-                p.begin(this);
-            } else {
-                p.begin(&_currentPixmap);
-            }
-            p.setClipRect(event->rect());
-        }
-
-        // draw fading start pixmap
-        if (opacity() <= 0.996 && !_startPixmap.isNull()) {
-            if (opacity() >= 0.004) {
-                fade(_startPixmap, _localStartPixmap, 1.0 - opacity(), rect);
-                p.drawPixmap(QPoint(), _localStartPixmap);
-
-            } else {
-                p.drawPixmap(QPoint(), _startPixmap);
-            }
+    // draw fading start pixmap
+    if (opacity() <= 0.996 && !_startPixmap.isNull()) {
+        if (opacity() >= 0.004) {
+            p.setOpacity(1.0 - opacity());
         }
-
-        p.end();
-    }
-
-    // copy current pixmap on widget
-    if (!paintOnWidget) {
-        QPainter p(this);
-        p.setClipRect(event->rect());
-        p.drawPixmap(QPoint(0, 0), _currentPixmap);
-        p.end();
+        p.drawPixmap(QPoint(), _startPixmap);
     }
 }
 
@@ -246,40 +223,47 @@ void TransitionWidget::grabBackground(QPixmap &pixmap, QWidget *widget, QRect &r
 }
 
 //________________________________________________
-void TransitionWidget::grabWidget(QPixmap &pixmap, QWidget *widget, QRect &rect) const
-{
-    widget->render(&pixmap, pixmap.rect().topLeft(), rect, QWidget::DrawChildren);
-}
-
-//________________________________________________
-void TransitionWidget::fade(const QPixmap &source, QPixmap &target, qreal opacity, const QRect &rect) const
+bool TransitionWidget::grabFromBackingStore(QPixmap &pixmap, QWidget *widget, const QRect &rect) const
 {
-    if (target.isNull() || target.size() != size()) {
-        target = QPixmap(size());
+    QWidget *window(widget->window());
+    if (widget->property(PropertyNames::noBackingStoreGrab).toBool() || window->property(PropertyNames::noBackingStoreGrab).toBool()) {
+        return false;
     }
 
-    // erase target
-    target.fill(Qt::transparent);
-
-    // check opacity
-    if (opacity * 255 < 1) {
-        return;
+    // windows using RHI composition hold the content of texture based children outside of the backing store,
+    // so that it is missing from the read back image
+    const QWindow *windowHandle(window->windowHandle());
+    if (!(windowHandle && windowHandle->surfaceType() == QSurface::RasterSurface) || hasTextureChildren(widget)) {
+        return false;
     }
 
-    QPainter p(&target);
-    p.setClipRect(rect);
+    // only raster backing stores can be read back
+    QBackingStore *backingStore(window->backingStore());
+    QPaintDevice *device(backingStore ? backingStore->paintDevice() : nullptr);
+    if (!(device && device->devType() == QInternal::Image)) {
+        return false;
+    }
 
-    // draw pixmap
-    p.drawPixmap(QPoint(0, 0), source);
+    const QImage *image(static_cast<const QImage *>(device));
 
-    // opacity mask (0.996 corresponds to 254/255)
-    if (opacity <= 0.996) {
-        p.setCompositionMode(QPainter::CompositionMode_DestinationIn);
-        QColor color(Qt::black);
-        color.setAlphaF(opacity);
-        p.fillRect(rect, color);
+    // grabbed rect, in backing store device pixels
+    const QRect windowRect(rect.translated(widget->mapTo(window, QPoint(0, 0))));
+    const qreal dpr(image->devicePixelRatio());
+    const QRect sourceRect(QRectF(QPointF(windowRect.topLeft()) * dpr, QSizeF(windowRect.size()) * dpr).toAlignedRect());
+    if (!image->rect().contains(sourceRect)) {
+        return false;
     }
 
+    QPainter p(&pixmap);
+    p.drawImage(QRect(QPoint(0, 0), rect.size()), *image, sourceRect);
     p.end();
+
+    return true;
+}
+
+//________________________________________________
+void TransitionWidget::grabWidget(QPixmap &pixmap, QWidget *widget, QRect &rect) const
+{
+    widget->render(&pixmap, pixmap.rect().topLeft(), rect, QWidget::DrawChildren);
 }
 }
@@ -12,6 +12,7 @@
 
 #include "breeze.h"
 #include "breezeanimation.h"
+#include "breezeanimationclock.h"
 
 #include <QWidget>
 
@@ -41,7 +42,7 @@ public:
         None = 0,
         GrabFromWindow = 1 << 0,
         Transparent = 1 << 1,
-        PaintOnWidget = 1 << 2,
+        GrabFromBackingStore = 1 << 2,
     };
 
     Q_DECLARE_FLAGS(Flags, Flag)
@@ -87,6 +88,19 @@ public:
         _steps = value;
     }
 
+    //* maximum area, in device pixels, for which transitions are performed. 0 means no limit
+    static void setMaxArea(int value)
+    {
+        _maxArea = value;
+    }
+
+    //* true if a widget of given size is too large to be animated
+    bool exceedsMaxArea(const QSize &size) const
+    {
+        const qreal dpr(devicePixelRatioF());
+        return _maxArea > 0 && qreal(size.width()) * size.height() * dpr * dpr > _maxArea;
+    }
+
     //*@name opacity
     //@{
 
@@ -102,7 +116,7 @@ public:
             return;
         }
         _opacity = value;
-        update();
+        AnimationClock::update(this);
     }
 
     //@}
@@ -138,7 +152,6 @@ public:
     void setEndPixmap(QPixmap pixmap)
     {
         _endPixmap = pixmap;
-        _currentPixmap = pixmap;
     }
 
     //* start
@@ -147,12 +160,6 @@ public:
         return _endPixmap;
     }
 
-    //* current
-    const QPixmap &currentPixmap() const
-    {
-        return _currentPixmap;
-    }
-
     //@}
 
     //* grab pixmap
@@ -198,12 +205,20 @@ protected:
     */
     void grabBackground(QPixmap &, QWidget *, QRect &) const;
 
+    //* grab widget and background from the window's backing store
+    /*!
+    The backing store holds the last painted frame of the window, which avoids
+    re-rendering the whole parent chain. Returns false if the backing store cannot
+    be read back, if the window uses RHI composition, if the widget has QOpenGLWidget,
+    QQuickWidget or QRhiWidget children, whose content is not held by the backing store,
+    or if the widget or its window has the noBackingStoreGrab property set,
+    in which case grabBackground and grabWidget must be used instead.
+    */
+    bool grabFromBackingStore(QPixmap &, QWidget *, const QRect &) const;
+
     //* grab widget
     void grabWidget(QPixmap &, QWidget *, QRect &) const;
 
-    //* fade pixmap
-    void fade(const QPixmap &source, QPixmap &target, qreal opacity, const QRect &) const;
-
     //* apply step
     qreal digitize(const qreal &value) const
     {
@@ -227,19 +242,16 @@ private:
     //* animation starting pixmap
     QPixmap _startPixmap;
 
-    //* animation starting pixmap
-    QPixmap _localStartPixmap;
-
-    //* animation starting pixmap
+    //* animation ending pixmap
     QPixmap _endPixmap;
 
-    //* current pixmap
-    QPixmap _currentPixmap;
-
     //* current state opacity
     qreal _opacity = 0;
 
     //* steps
     static int _steps;
+
+    //* max area
+    static int _maxArea;
 };
 }
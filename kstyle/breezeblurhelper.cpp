@@ -75,7 +75,7 @@ bool BlurHelper::eventFilter(QObject *object, QEvent *event)
 }
 
 //___________________________________________________________
-void BlurHelper::update(QWidget *widget) const
+void BlurHelper::update(QWidget *widget)
 {
     /*
     directly from bespin code. Supposedly prevent playing with some 'pseudo-widgets'
@@ -91,7 +91,21 @@ void BlurHelper::update(QWidget *widget) const
     if (const auto menu = qobject_cast<QMenu *>(widget)) {
         region = _helper->menuFrameRegion(menu);
     }
-    KWindowEffects::enableBlurBehind(widget->windowHandle(), true, region);
+
+    // skip the window manager round-trip if the region did not change since last call for this window
+    QWindow *window(widget->windowHandle());
+    const auto iter = _blurRegions.find(window);
+    if (iter == _blurRegions.end()) {
+        connect(window, &QObject::destroyed, this, [this, window]() {
+            _blurRegions.remove(window);
+        });
+        _blurRegions.insert(window, {widget->winId(), region});
+        KWindowEffects::enableBlurBehind(window, true, region);
+
+    } else if (iter->winId != widget->winId() || iter->region != region) {
+        *iter = {widget->winId(), region};
+        KWindowEffects::enableBlurBehind(window, true, region);
+    }
 
     // force update
     if (widget->isVisible()) {
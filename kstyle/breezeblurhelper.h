@@ -19,6 +19,8 @@
 
 #include <QHash>
 #include <QObject>
+#include <QRegion>
+#include <QWindow>
 
 namespace Breeze
 {
@@ -48,9 +50,16 @@ protected:
     }
 
     //! update blur regions for given widget
-    void update(QWidget *) const;
+    void update(QWidget *);
 
 private:
     std::shared_ptr<Helper> _helper;
+
+    //! blur region last passed to the window manager, per window
+    struct BlurRegion {
+        WId winId = 0;
+        QRegion region;
+    };
+    QHash<const QWindow *, BlurRegion> _blurRegions;
 };
 }
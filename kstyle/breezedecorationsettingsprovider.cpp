@@ -47,6 +47,12 @@ void DecorationSettingsProvider::reconfigure()
 {
     m_defaultSettings->load();
 
+    // presets may have been changed, so are parsed again when next needed
+    m_parsedPresets.clear();
+    if (m_presetsConfig) {
+        m_presetsConfig->reparseConfiguration();
+    }
+
     DecorationExceptionList exceptions;
     exceptions.readConfig(m_config);
     m_exceptions = exceptions.getDefault();
@@ -78,7 +84,10 @@ InternalSettingsPtr DecorationSettingsProvider::internalSettings()
                     return internalSettings;
                 }
 
-                PresetsModel::loadPreset(internalSettings.data(), m_presetsConfig.data(), internalSettings->exceptionPreset());
+                const std::optional<ParsedPreset> &preset(parsedPreset(internalSettings->exceptionPreset()));
+                if (preset) {
+                    PresetsModel::applyPreset(internalSettings.data(), *preset);
+                }
                 internalSettings->setProperty("noCacheException",
                                               true); // this property is to indicate not to cache shadows or colours for an exception with a Preset
                                                      // -- this is because the Preset exception can alter shadows and colours
@@ -96,4 +105,14 @@ InternalSettingsPtr DecorationSettingsProvider::internalSettings()
 
     return m_defaultSettings;
 }
+
+//__________________________________________________________________
+const std::optional<ParsedPreset> &DecorationSettingsProvider::parsedPreset(const QString &presetName)
+{
+    auto it = m_parsedPresets.find(presetName);
+    if (it == m_parsedPresets.end()) {
+        it = m_parsedPresets.insert(presetName, PresetsModel::parsePreset(m_presetsConfig.data(), presetName));
+    }
+    return it.value();
+}
 }
@@ -14,6 +14,7 @@
 
 #include "breeze.h"
 #include "breezesettings.h"
+#include "presetsmodel.h"
 
 #include <KSharedConfig>
 #include <QMainWindow>
@@ -42,6 +43,9 @@ public Q_SLOTS:
     void reconfigure();
 
 private:
+    //* parsed preset from m_presetsConfig, parsing it if not yet cached. std::nullopt if the preset is not present
+    const std::optional<ParsedPreset> &parsedPreset(const QString &presetName);
+
     //* constructor
     DecorationSettingsProvider();
 
@@ -57,6 +61,9 @@ private:
     //* presets config object
     KSharedConfigPtr m_presetsConfig;
 
+    //* parsed presets used by exceptions, by preset name, so that each is only read once per configuration change
+    QHash<QString, std::optional<ParsedPreset>> m_parsedPresets;
+
     //* singleton
     static DecorationSettingsProvider *s_self;
 };
@@ -120,8 +120,7 @@ void FrameShadowFactory::installShadows(QWidget *widget, const std::shared_ptr<H
     widget->installEventFilter(this);
 
     widget->installEventFilter(&_addEventFilter);
-    installShadow(widget, helper, SideTop);
-    installShadow(widget, helper, SideBottom);
+    installShadow(widget, helper);
     widget->removeEventFilter(&_addEventFilter);
 }
 
@@ -143,56 +142,57 @@ void FrameShadowFactory::removeShadows(QWidget *widget)
 //____________________________________________________________________________________
 void FrameShadowFactory::updateShadowsGeometry(const QObject *object, QRect rect) const
 {
-    const QList<QObject *> &children = object->children();
-    for (QObject *child : children) {
-        if (FrameShadow *shadow = qobject_cast<FrameShadow *>(child)) {
-            shadow->updateGeometry(rect);
-        }
+    if (FrameShadow *shadow = this->shadow(object)) {
+        shadow->updateGeometry(rect);
     }
 }
 
 //____________________________________________________________________________________
 void FrameShadowFactory::raiseShadows(QObject *object) const
 {
-    const QList<QObject *> &children = object->children();
-    for (QObject *child : children) {
-        if (FrameShadow *shadow = qobject_cast<FrameShadow *>(child)) {
-            shadow->raise();
-        }
+    if (FrameShadow *shadow = this->shadow(object)) {
+        shadow->raise();
     }
 }
 
 //____________________________________________________________________________________
 void FrameShadowFactory::update(QObject *object) const
 {
-    const QList<QObject *> &children = object->children();
-    for (QObject *child : children) {
-        if (FrameShadow *shadow = qobject_cast<FrameShadow *>(child)) {
-            shadow->update();
-        }
+    if (FrameShadow *shadow = this->shadow(object)) {
+        shadow->update();
     }
 }
 
 //____________________________________________________________________________________
 void FrameShadowFactory::updateState(const QWidget *widget, bool focus, bool hover, qreal opacity, AnimationMode mode) const
 {
-    const QList<QObject *> &children = widget->children();
-    for (QObject *child : children) {
-        if (FrameShadow *shadow = qobject_cast<FrameShadow *>(child)) {
-            shadow->updateState(focus, hover, opacity, mode);
-        }
+    if (FrameShadow *shadow = this->shadow(widget)) {
+        shadow->updateState(focus, hover, opacity, mode);
     }
 }
 
 //____________________________________________________________________________________
-void FrameShadowFactory::installShadow(QWidget *widget, const std::shared_ptr<Helper> &helper, Side area) const
+void FrameShadowFactory::installShadow(QWidget *widget, const std::shared_ptr<Helper> &helper) const
 {
     FrameShadow *shadow(nullptr);
-    shadow = new FrameShadow(area, helper);
+    shadow = new FrameShadow(helper);
     shadow->setParent(widget);
     shadow->hide();
 }
 
+//____________________________________________________________________________________
+FrameShadow *FrameShadowFactory::shadow(const QObject *object) const
+{
+    const QList<QObject *> &children = object->children();
+    for (QObject *child : children) {
+        if (FrameShadow *shadow = qobject_cast<FrameShadow *>(child)) {
+            return shadow;
+        }
+    }
+
+    return nullptr;
+}
+
 //____________________________________________________________________________________
 void FrameShadowFactory::widgetDestroyed(QObject *object)
 {
@@ -200,9 +200,8 @@ void FrameShadowFactory::widgetDestroyed(QObject *object)
 }
 
 //____________________________________________________________________________________
-FrameShadow::FrameShadow(Side area, const std::shared_ptr<Helper> &helper)
+FrameShadow::FrameShadow(const std::shared_ptr<Helper> &helper)
     : _helper(helper)
-    , _area(area)
 {
     Q_ASSERT(helper);
 
@@ -235,33 +234,15 @@ void FrameShadow::updateGeometry(QRect rect)
 
     // for efficiency, take out the part for which nothing is rendered
     rect.adjust(1, 1, -1, -1);
+    setGeometry(rect);
 
-    // adjust geometry
+    // only the top and bottom strips, in which the rounded frame overlaps the viewport, are rendered
     const int shadowSize(Metrics::Frame_FrameRadius);
-    switch (_area) {
-    case SideTop:
-        rect.setHeight(shadowSize);
-        break;
-
-    case SideBottom:
-        rect.setTop(rect.bottom() - shadowSize + 1);
-        break;
-
-    case SideLeft:
-        rect.setWidth(shadowSize);
-        rect.adjust(0, shadowSize, 0, -shadowSize);
-        break;
-
-    case SideRight:
-        rect.setLeft(rect.right() - shadowSize + 1);
-        rect.adjust(0, shadowSize, 0, -shadowSize);
-        break;
-
-    default:
-        return;
+    QRegion mask(0, 0, rect.width(), shadowSize);
+    mask += QRect(0, rect.height() - shadowSize, rect.width(), shadowSize);
+    if (mask != this->mask()) {
+        setMask(mask);
     }
-
-    setGeometry(rect);
 }
 
 //____________________________________________________________________________________
@@ -21,6 +21,8 @@
 namespace Breeze
 {
 
+class FrameShadow;
+
 //* shadow manager
 class FrameShadowFactory : public QObject
 {
@@ -64,8 +66,11 @@ protected:
     //* update shadows
     void update(QObject *) const;
 
-    //* install shadow on given side
-    void installShadow(QWidget *, const std::shared_ptr<Helper> &helper, Side area) const;
+    //* install shadow overlay
+    void installShadow(QWidget *, const std::shared_ptr<Helper> &helper) const;
+
+    //* shadow overlay installed on given widget, if any
+    FrameShadow *shadow(const QObject *) const;
 
 protected Q_SLOTS:
 
@@ -81,14 +86,18 @@ private:
 };
 
 //* frame shadow
-/** this allows the shadow to be painted over the widgets viewport */
+/**
+this allows the shadow to be painted over the widgets viewport.
+A single overlay is used per frame, masked to the top and bottom strips in which the
+rounded frame overlaps the viewport, so that it does not cause the viewport contents to be repainted
+*/
 class FrameShadow : public QWidget
 {
     Q_OBJECT
 
 public:
     //* constructor
-    FrameShadow(Side, const std::shared_ptr<Helper> &helper);
+    explicit FrameShadow(const std::shared_ptr<Helper> &helper);
 
     //* update geometry
     virtual void updateGeometry(QRect);
@@ -107,9 +116,6 @@ private:
     //* helper
     std::shared_ptr<Helper> _helper;
 
-    //* shadow area
-    Side _area;
-
     //* margins
     /** offsets between update rect and parent widget rect. It is set via updateGeometry */
     QMargins _margins;
@@ -675,10 +675,16 @@ QRegion Helper::menuFrameRegion(const QMenu *widget)
     const auto roundCorners = hasAlpha;
 
     if (roundCorners) {
-        QRectF frameRect(widget->rect());
-
         qreal radius(Metrics::Frame_FrameRadius);
 
+        // rounding the path into a polygon is expensive, and menus of a given size are shown over and over
+        const MenuFrameRegionKey key{widget->size(), int(seamlessEdges), radius, widget->devicePixelRatioF()};
+        if (const auto iter = _menuFrameRegions.find(key); iter != _menuFrameRegions.end()) {
+            return iter->second;
+        }
+
+        QRectF frameRect(widget->rect());
+
         frameRect.adjust( //
             seamlessEdges.testFlag(Qt::LeftEdge) ? -radius : 0,
             seamlessEdges.testFlag(Qt::TopEdge) ? -radius : 0,
@@ -691,7 +697,14 @@ QRegion Helper::menuFrameRegion(const QMenu *widget)
 
         QPainterPath path;
         path.addRoundedRect(frameRect, radius, radius);
-        return QRegion(path.toFillPolygon().toPolygon()).intersected(widget->rect());
+        const QRegion region(QRegion(path.toFillPolygon().toPolygon()).intersected(widget->rect()));
+
+        // keep the cache bounded
+        if (_menuFrameRegions.size() >= 64) {
+            _menuFrameRegions.clear();
+        }
+        _menuFrameRegions.emplace(key, region);
+        return region;
     }
 
     return QRegion(widget->rect());
@@ -1336,41 +1349,44 @@ void Helper::renderProgressBarBusyContents(QPainter *painter,
         radius = 0.5 * Metrics::ProgressBar_Thickness;
     }
 
-    // setup brush
-    QPixmap pixmap(horizontal ? 2 * Metrics::ProgressBar_BusyIndicatorSize : 1, horizontal ? 1 : 2 * Metrics::ProgressBar_BusyIndicatorSize);
-    pixmap.fill(second);
-    if (horizontal) {
-        QPainter painter(&pixmap);
-        painter.setBrush(first);
-        painter.setPen(Qt::NoPen);
+    // stripe position
+    progress %= 2 * Metrics::ProgressBar_BusyIndicatorSize;
+    if (reverse || !horizontal) {
+        progress = 2 * Metrics::ProgressBar_BusyIndicatorSize - progress - 1;
+    }
 
-        progress %= 2 * Metrics::ProgressBar_BusyIndicatorSize;
-        if (reverse) {
-            progress = 2 * Metrics::ProgressBar_BusyIndicatorSize - progress - 1;
-        }
-        painter.drawRect(QRect(0, 0, Metrics::ProgressBar_BusyIndicatorSize, 1).translated(progress, 0));
+    // setup brush. The stripe is rendered once and scrolled by translating the brush
+    QBrush brush(busyStripe(first, second, horizontal));
+    brush.setTransform(horizontal ? QTransform::fromTranslate(progress, 0) : QTransform::fromTranslate(0, progress));
 
-        if (progress > Metrics::ProgressBar_BusyIndicatorSize) {
-            painter.drawRect(QRect(0, 0, Metrics::ProgressBar_BusyIndicatorSize, 1).translated(progress - 2 * Metrics::ProgressBar_BusyIndicatorSize, 0));
-        }
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(brush);
+    painter->drawRoundedRect(baseRect, radius, radius);
+}
 
-    } else {
+//______________________________________________________________________________
+const QPixmap &Helper::busyStripe(const QColor &first, const QColor &second, bool horizontal) const
+{
+    const BusyStripeKey key{first.rgba(), second.rgba(), horizontal};
+    if (const auto iter = _busyStripes.find(key); iter != _busyStripes.end()) {
+        return iter->second;
+    }
+
+    // color changes are rare, but do not let the cache grow unbounded
+    if (_busyStripes.size() >= 16) {
+        _busyStripes.clear();
+    }
+
+    QPixmap pixmap(horizontal ? 2 * Metrics::ProgressBar_BusyIndicatorSize : 1, horizontal ? 1 : 2 * Metrics::ProgressBar_BusyIndicatorSize);
+    pixmap.fill(second);
+    {
         QPainter painter(&pixmap);
         painter.setBrush(first);
         painter.setPen(Qt::NoPen);
-
-        progress %= 2 * Metrics::ProgressBar_BusyIndicatorSize;
-        progress = 2 * Metrics::ProgressBar_BusyIndicatorSize - progress - 1;
-        painter.drawRect(QRect(0, 0, 1, Metrics::ProgressBar_BusyIndicatorSize).translated(0, progress));
-
-        if (progress > Metrics::ProgressBar_BusyIndicatorSize) {
-            painter.drawRect(QRect(0, 0, 1, Metrics::ProgressBar_BusyIndicatorSize).translated(0, progress - 2 * Metrics::ProgressBar_BusyIndicatorSize));
-        }
+        painter.drawRect(horizontal ? QRect(0, 0, Metrics::ProgressBar_BusyIndicatorSize, 1) : QRect(0, 0, 1, Metrics::ProgressBar_BusyIndicatorSize));
     }
 
-    painter->setPen(Qt::NoPen);
-    painter->setBrush(pixmap);
-    painter->drawRoundedRect(baseRect, radius, radius);
+    return _busyStripes.emplace(key, pixmap).first->second;
 }
 
 //______________________________________________________________________________
@@ -27,6 +27,9 @@
 #include <QWidget>
 #include <qpainter.h>
 
+#include <map>
+#include <tuple>
+
 class QSlider;
 class QStyleOptionSlider;
 
@@ -452,6 +455,42 @@ private:
 
     qreal _contrastBias;
 
+    //* menu frame region cache key
+    struct MenuFrameRegionKey {
+        QSize size;
+        int seamlessEdges = 0;
+        qreal radius = 0;
+        qreal devicePixelRatio = 1;
+
+        bool operator<(const MenuFrameRegionKey &other) const
+        {
+            return std::make_tuple(size.width(), size.height(), seamlessEdges, radius, devicePixelRatio)
+                < std::make_tuple(other.size.width(), other.size.height(), other.seamlessEdges, other.radius, other.devicePixelRatio);
+        }
+    };
+
+    //* cached menu frame regions
+    std::map<MenuFrameRegionKey, QRegion> _menuFrameRegions;
+
+    //* busy indicator stripe cache key
+    struct BusyStripeKey {
+        QRgb first = 0;
+        QRgb second = 0;
+        bool horizontal = true;
+
+        bool operator<(const BusyStripeKey &other) const
+        {
+            return std::tie(first, second, horizontal) < std::tie(other.first, other.second, other.horizontal);
+        }
+    };
+
+    //* busy indicator stripe, for given colors and orientation
+    /** it covers one animation period and is animated by translating the brush */
+    const QPixmap &busyStripe(const QColor &first, const QColor &second, bool horizontal) const;
+
+    //* cached busy indicator stripes
+    mutable std::map<BusyStripeKey, QPixmap> _busyStripes;
+
     friend class ToolsAreaManager;
 };
 
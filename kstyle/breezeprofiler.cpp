@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezeprofiler.h"
+
+#include <QCoreApplication>
+#include <QMutex>
+#include <QMutexLocker>
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace Breeze
+{
+
+namespace
+{
+//* section key. Either name or id/nameFunction is set
+struct Key {
+    const char *category = nullptr;
+    const char *name = nullptr;
+    int id = 0;
+    Profiler::NameFunction nameFunction = nullptr;
+
+    bool operator<(const Key &other) const
+    {
+        return std::tie(category, name, id, nameFunction) < std::tie(other.category, other.name, other.id, other.nameFunction);
+    }
+};
+
+//* cumulated samples
+struct Entry {
+    qint64 nsecs = 0;
+    quint64 calls = 0;
+};
+
+//* recorded samples. Painting may happen outside of the main thread, hence the mutex
+struct Samples {
+    QMutex mutex;
+    std::map<Key, Entry> entries;
+};
+
+Q_GLOBAL_STATIC(Samples, s_samples)
+
+//* print summary, sorted by category and decreasing time
+void printSummary()
+{
+    if (s_samples.isDestroyed()) {
+        return;
+    }
+
+    QMutexLocker locker(&s_samples->mutex);
+
+    struct Line {
+        QByteArray category;
+        QByteArray name;
+        Entry entry;
+    };
+
+    std::vector<Line> lines;
+    lines.reserve(s_samples->entries.size());
+    for (const auto &[key, entry] : s_samples->entries) {
+        lines.push_back({QByteArray(key.category), key.nameFunction ? key.nameFunction(key.id) : QByteArray(key.name), entry});
+    }
+
+    std::sort(lines.begin(), lines.end(), [](const Line &first, const Line &second) {
+        return std::make_tuple(first.category, -first.entry.nsecs) < std::make_tuple(second.category, -second.entry.nsecs);
+    });
+
+    std::fprintf(stderr, "klassy style profile (%s)\n", qPrintable(QCoreApplication::applicationName()));
+    std::fprintf(stderr, "%-16s %-40s %12s %10s %10s\n", "category", "section", "total (ms)", "calls", "mean (us)");
+    for (const Line &line : lines) {
+        std::fprintf(stderr,
+                     "%-16s %-40s %12.3f %10llu %10.3f\n",
+                     line.category.constData(),
+                     line.name.constData(),
+                     line.entry.nsecs / 1e6,
+                     static_cast<unsigned long long>(line.entry.calls),
+                     line.entry.calls ? line.entry.nsecs / 1e3 / line.entry.calls : 0.0);
+    }
+}
+
+//* add sample, registering summary output on first call
+void addSample(const Key &key, qint64 nsecs)
+{
+    if (s_samples.isDestroyed()) {
+        return;
+    }
+
+    QMutexLocker locker(&s_samples->mutex);
+    if (s_samples->entries.empty()) {
+        qAddPostRoutine(printSummary);
+    }
+
+    Entry &entry(s_samples->entries[key]);
+    entry.nsecs += nsecs;
+    ++entry.calls;
+}
+}
+
+//____________________________________________________________________
+void Profiler::record(const char *category, const char *name, qint64 nsecs)
+{
+    addSample({category, name, 0, nullptr}, nsecs);
+}
+
+//____________________________________________________________________
+void Profiler::record(const char *category, int id, NameFunction nameFunction, qint64 nsecs)
+{
+    addSample({category, nullptr, id, nameFunction}, nsecs);
+}
+}
@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QMetaEnum>
+
+namespace Breeze
+{
+
+//* startup profiling
+/**
+enabled by setting the KLASSY_STYLE_PROFILE environment variable.
+Cumulated time and call count are recorded per section, and a summary
+is printed to stderr when the application exits. Times are inclusive:
+nested draw calls are also counted in the calling section
+*/
+class Profiler
+{
+public:
+    //* converts a section id to a printable name
+    using NameFunction = QByteArray (*)(int);
+
+    //* true if profiling is enabled
+    static bool enabled()
+    {
+        static const bool enabled(qEnvironmentVariableIsSet("KLASSY_STYLE_PROFILE"));
+        return enabled;
+    }
+
+    //* record elapsed time for a named section
+    static void record(const char *category, const char *name, qint64 nsecs);
+
+    //* record elapsed time for a section identified by an enum value
+    static void record(const char *category, int id, NameFunction nameFunction, qint64 nsecs);
+};
+
+//* times the enclosing scope, when profiling is enabled
+class ProfileScope
+{
+public:
+    //* named section
+    ProfileScope(const char *category, const char *name)
+        : _category(category)
+        , _name(name)
+    {
+        if (Profiler::enabled()) {
+            _timer.start();
+        }
+    }
+
+    //* section identified by a QStyle enum value
+    template<typename Enum>
+    ProfileScope(const char *category, Enum id)
+        : _category(category)
+        , _id(int(id))
+        , _nameFunction(&enumName<Enum>)
+    {
+        if (Profiler::enabled()) {
+            _timer.start();
+        }
+    }
+
+    //* destructor
+    ~ProfileScope()
+    {
+        if (_timer.isValid()) {
+            flush();
+        }
+    }
+
+    //* record current section and start timing the next one, within the same category
+    void next(const char *name)
+    {
+        if (_timer.isValid()) {
+            flush();
+            _name = name;
+            _timer.start();
+        }
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+private:
+    //* enum value name
+    template<typename Enum>
+    static QByteArray enumName(int id)
+    {
+        const char *key(QMetaEnum::fromType<Enum>().valueToKey(id));
+        return key ? QByteArray(key) : QByteArray::number(id);
+    }
+
+    //* record current section
+    void flush()
+    {
+        const qint64 nsecs(_timer.nsecsElapsed());
+        if (_nameFunction) {
+            Profiler::record(_category, _id, _nameFunction, nsecs);
+        } else {
+            Profiler::record(_category, _name, nsecs);
+        }
+    }
+
+    const char *_category = nullptr;
+    const char *_name = nullptr;
+    int _id = 0;
+    Profiler::NameFunction _nameFunction = nullptr;
+    QElapsedTimer _timer;
+};
+}
@@ -11,6 +11,7 @@ namespace Breeze
 
 const char PropertyNames::noAnimations[] = "_kde_no_animations";
 const char PropertyNames::noWindowGrab[] = "_kde_no_window_grab";
+const char PropertyNames::noBackingStoreGrab[] = "_breeze_no_backing_store_grab";
 const char PropertyNames::netWMForceShadow[] = "_KDE_NET_WM_FORCE_SHADOW";
 const char PropertyNames::netWMSkipShadow[] = "_KDE_NET_WM_SKIP_SHADOW";
 const char PropertyNames::sidePanelView[] = "_kde_side_panel_view";
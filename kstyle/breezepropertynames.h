@@ -12,6 +12,7 @@ namespace Breeze
 struct PropertyNames {
     static const char noAnimations[];
     static const char noWindowGrab[];
+    static const char noBackingStoreGrab[];
     static const char netWMForceShadow[];
     static const char netWMSkipShadow[];
     static const char sidePanelView[];
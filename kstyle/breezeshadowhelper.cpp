@@ -83,8 +83,7 @@ ShadowHelper::~ShadowHelper()
 //______________________________________________
 void ShadowHelper::reset()
 {
-    _tiles.clear();
-    _shadowTiles = TileSet();
+    _shadowTiles.clear();
 }
 
 //_______________________________________________________
@@ -154,7 +153,8 @@ bool ShadowHelper::eventFilter(QObject *object, QEvent *event)
         QWidget *widget(static_cast<QWidget *>(object));
 
         // install shadows and update winId
-        installShadows(widget);
+        // the shadow is attached to the native window, so it must be re-created when the latter changes
+        installShadows(widget, true);
 
     } else {
         if (event->type() != QEvent::PlatformSurface) {
@@ -179,19 +179,51 @@ bool ShadowHelper::eventFilter(QObject *object, QEvent *event)
 
 //_______________________________________________________
 TileSet ShadowHelper::shadowTiles(QWidget *widget)
+{
+    ShadowTiles *shadowTiles(findShadowTiles(widget));
+    if (!shadowTiles) {
+        return TileSet();
+    }
+
+    if (!shadowTiles->tileSet.isValid()) {
+        shadowTiles->tileSet = TileSet(QPixmap::fromImage(shadowTiles->texture), shadowTiles->innerRectTopLeft.x(), shadowTiles->innerRectTopLeft.y(), 1, 1);
+    }
+
+    return shadowTiles->tileSet;
+}
+
+//_______________________________________________________
+ShadowTilesKey ShadowHelper::shadowTilesKey(QWidget *widget) const
+{
+    const bool active = true;
+
+    ShadowTilesKey key;
+    key.devicePixelRatio = devicePixelRatio(widget);
+    key.shadowSize = _helper->decorationConfig()->shadowSize(active);
+    key.color = _helper->decorationConfig()->shadowColor(active).rgba();
+    key.strength = _helper->decorationConfig()->shadowStrength(active);
+    key.frameRadius = _helper->frameRadius();
+    return key;
+}
+
+//_______________________________________________________
+ShadowHelper::ShadowTiles *ShadowHelper::findShadowTiles(QWidget *widget)
 {
     bool active = true;
 
     CompositeShadowParams params = lookupShadowParams(_helper->decorationConfig()->shadowSize(active));
 
     if (params.isNone()) {
-        return TileSet();
-    } else if (_shadowTiles.isValid()) {
-        return _shadowTiles;
+        return nullptr;
     }
 
-    const qreal dpr = devicePixelRatio(widget);
-    params *= dpr;
+    const ShadowTilesKey key(shadowTilesKey(widget));
+    auto iter = _shadowTiles.find(key);
+    if (iter != _shadowTiles.end()) {
+        return &iter.value();
+    }
+
+    params *= key.devicePixelRatio;
 
     auto withOpacity = [](const QColor &color, qreal opacity) -> QColor {
         QColor c(color);
@@ -200,12 +232,12 @@ TileSet ShadowHelper::shadowTiles(QWidget *widget)
     };
 
     const QColor color = _helper->decorationConfig()->shadowColor(active);
-    const qreal strength = static_cast<qreal>(_helper->decorationConfig()->shadowStrength(active)) / 255.0;
+    const qreal strength = static_cast<qreal>(key.strength) / 255.0;
 
     const QSize boxSize =
         BoxShadowRenderer::calculateMinimumBoxSize(params.shadow1.radius).expandedTo(BoxShadowRenderer::calculateMinimumBoxSize(params.shadow2.radius));
 
-    const qreal frameRadius = _helper->frameRadius();
+    const qreal frameRadius = key.frameRadius;
 
     BoxShadowRenderer shadowRenderer;
     shadowRenderer.setBorderRadius(frameRadius);
@@ -238,10 +270,11 @@ TileSet ShadowHelper::shadowTiles(QWidget *widget)
     // We're done.
     painter.end();
 
-    const QPoint innerRectTopLeft = outerRect.center();
-    _shadowTiles = TileSet(QPixmap::fromImage(std::move(shadowTexture)), innerRectTopLeft.x(), innerRectTopLeft.y(), 1, 1);
+    ShadowTiles shadowTiles;
+    shadowTiles.texture = std::move(shadowTexture);
+    shadowTiles.innerRectTopLeft = outerRect.center();
 
-    return _shadowTiles;
+    return &_shadowTiles.insert(key, shadowTiles).value();
 }
 
 //_______________________________________________________
@@ -318,34 +351,41 @@ bool ShadowHelper::acceptWidget(QWidget *widget) const
 }
 
 //______________________________________________
-const QVector<KWindowShadowTile::Ptr> &ShadowHelper::createShadowTiles()
+const QVector<KWindowShadowTile::Ptr> &ShadowHelper::createShadowTiles(ShadowTiles &shadowTiles)
 {
     // make sure size is valid
-    if (_tiles.isEmpty()) {
-        _tiles = {createTile(_shadowTiles.pixmap(1)),
-                  createTile(_shadowTiles.pixmap(2)),
-                  createTile(_shadowTiles.pixmap(5)),
-                  createTile(_shadowTiles.pixmap(8)),
-                  createTile(_shadowTiles.pixmap(7)),
-                  createTile(_shadowTiles.pixmap(6)),
-                  createTile(_shadowTiles.pixmap(3)),
-                  createTile(_shadowTiles.pixmap(0))};
+    if (shadowTiles.tiles.isEmpty()) {
+        // split texture the same way as TileSet does, around a 1x1 center tile
+        const QImage &texture(shadowTiles.texture);
+        const int w1(shadowTiles.innerRectTopLeft.x());
+        const int h1(shadowTiles.innerRectTopLeft.y());
+        const int w3(texture.width() - w1 - 1);
+        const int h3(texture.height() - h1 - 1);
+
+        shadowTiles.tiles = {createTile(texture.copy(w1, 0, 1, h1)),
+                             createTile(texture.copy(w1 + 1, 0, w3, h1)),
+                             createTile(texture.copy(w1 + 1, h1, w3, 1)),
+                             createTile(texture.copy(w1 + 1, h1 + 1, w3, h3)),
+                             createTile(texture.copy(w1, h1 + 1, 1, h3)),
+                             createTile(texture.copy(0, h1 + 1, w1, h3)),
+                             createTile(texture.copy(0, h1, w1, 1)),
+                             createTile(texture.copy(0, 0, w1, h1))};
     }
 
     // return relevant list of shadow tiles
-    return _tiles;
+    return shadowTiles.tiles;
 }
 
 //______________________________________________
-KWindowShadowTile::Ptr ShadowHelper::createTile(const QPixmap &source)
+KWindowShadowTile::Ptr ShadowHelper::createTile(const QImage &source)
 {
     KWindowShadowTile::Ptr tile = KWindowShadowTile::Ptr::create();
-    tile->setImage(source.toImage());
+    tile->setImage(source);
     return tile;
 }
 
 //_______________________________________________________
-void ShadowHelper::installShadows(QWidget *widget)
+void ShadowHelper::installShadows(QWidget *widget, bool force)
 {
     if (!widget) {
         return;
@@ -362,13 +402,13 @@ void ShadowHelper::installShadows(QWidget *widget)
     }
 
     // create shadow tiles if needed
-    shadowTiles(widget);
-    if (!_shadowTiles.isValid()) {
+    ShadowTiles *shadowTiles(findShadowTiles(widget));
+    if (!shadowTiles) {
         return;
     }
 
     // create platform shadow tiles if needed
-    const QVector<KWindowShadowTile::Ptr> &tiles = createShadowTiles();
+    const QVector<KWindowShadowTile::Ptr> &tiles = createShadowTiles(*shadowTiles);
     if (tiles.count() != numTiles) {
         return;
     }
@@ -387,6 +427,14 @@ void ShadowHelper::installShadows(QWidget *widget)
         connect(window, &QWindow::destroyed, this, &ShadowHelper::windowDeleted);
     }
 
+    // nothing to do if the shadow is already installed with the same tiles and padding.
+    // KWindowShadow itself re-creates the shadow when the platform surface is re-created,
+    // which happens every time a popup menu or tooltip is shown
+    const QMargins padding(shadowMargins(widget));
+    if (!force && shadow->isCreated() && shadow->window() == window && shadow->padding() == padding && hasTiles(shadow, tiles)) {
+        return;
+    }
+
     if (shadow->isCreated()) {
         shadow->destroy();
     }
@@ -399,11 +447,18 @@ void ShadowHelper::installShadows(QWidget *widget)
     shadow->setBottomLeftTile(tiles[5]);
     shadow->setLeftTile(tiles[6]);
     shadow->setTopLeftTile(tiles[7]);
-    shadow->setPadding(shadowMargins(widget));
+    shadow->setPadding(padding);
     shadow->setWindow(window);
     shadow->create();
 }
 
+//_______________________________________________________
+bool ShadowHelper::hasTiles(const KWindowShadow *shadow, const QVector<KWindowShadowTile::Ptr> &tiles)
+{
+    return shadow->topTile() == tiles[0] && shadow->topRightTile() == tiles[1] && shadow->rightTile() == tiles[2] && shadow->bottomRightTile() == tiles[3]
+        && shadow->bottomTile() == tiles[4] && shadow->bottomLeftTile() == tiles[5] && shadow->leftTile() == tiles[6] && shadow->topLeftTile() == tiles[7];
+}
+
 //_______________________________________________________
 QMargins ShadowHelper::shadowMargins(QWidget *widget) const
 {
@@ -9,63 +9,35 @@
 
 #include "breezehelper.h"
 #include "breezetileset.h"
+#include "shadowparams.h"
 
 #include <KWindowShadow>
 
+#include <QImage>
 #include <QMap>
 #include <QMargins>
 #include <QObject>
 #include <QPointer>
 #include <QSet>
 
+#include <tuple>
+
 namespace Breeze
 {
 
-struct ShadowParams {
-    ShadowParams() = default;
-
-    ShadowParams(const QPoint &offset, int radius, qreal opacity)
-        : offset(offset)
-        , radius(radius)
-        , opacity(opacity)
-    {
-    }
-
-    QPoint offset;
-    int radius = 0;
-    qreal opacity = 0;
-
-    void operator*=(qreal factor)
-    {
-        offset *= factor;
-        radius = qRound(radius * factor);
-    }
-};
-
-struct CompositeShadowParams {
-    CompositeShadowParams() = default;
-
-    CompositeShadowParams(const QPoint &offset, const ShadowParams &shadow1, const ShadowParams &shadow2)
-        : offset(offset)
-        , shadow1(shadow1)
-        , shadow2(shadow2)
-    {
-    }
-
-    bool isNone() const
-    {
-        return qMax(shadow1.radius, shadow2.radius) == 0;
-    }
-
-    QPoint offset;
-    ShadowParams shadow1;
-    ShadowParams shadow2;
+//* identifies a set of shadow tiles
+/** shadow tiles depend on the device pixel ratio of the screen the window is on, and on the shadow settings */
+struct ShadowTilesKey {
+    qreal devicePixelRatio = 1;
+    int shadowSize = 0;
+    QRgb color = 0;
+    int strength = 0;
+    qreal frameRadius = 0;
 
-    void operator*=(qreal factor)
+    bool operator<(const ShadowTilesKey &other) const
     {
-        offset *= factor;
-        shadow1 *= factor;
-        shadow2 *= factor;
+        return std::tie(devicePixelRatio, shadowSize, color, strength, frameRadius)
+            < std::tie(other.devicePixelRatio, other.shadowSize, other.color, other.strength, other.frameRadius);
     }
 };
 
@@ -135,14 +107,39 @@ protected:
     //* accept widget
     bool acceptWidget(QWidget *) const;
 
-    // create shared shadow tiles from tileset
-    const QVector<KWindowShadowTile::Ptr> &createShadowTiles();
+    //* rendered shadow texture, and tiles created from it
+    struct ShadowTiles {
+        //* shadow texture
+        QImage texture;
 
-    // create shadow tile from pixmap
-    KWindowShadowTile::Ptr createTile(const QPixmap &);
+        //* top left corner of the inner rect, in texture coordinates
+        QPoint innerRectTopLeft;
+
+        //* tileset, used for mdi windows. Created on demand
+        TileSet tileSet;
+
+        //* platform tiles. Created on demand
+        QVector<KWindowShadowTile::Ptr> tiles;
+    };
+
+    //* shadow tiles key for given widget
+    ShadowTilesKey shadowTilesKey(QWidget *) const;
+
+    //* find or render shadow texture for given widget. Returns nullptr if there is no shadow
+    ShadowTiles *findShadowTiles(QWidget *);
+
+    // create shared shadow tiles from texture
+    const QVector<KWindowShadowTile::Ptr> &createShadowTiles(ShadowTiles &);
+
+    // create shadow tile from image
+    KWindowShadowTile::Ptr createTile(const QImage &);
 
     //* installs shadow on given widget in a platform independent way
-    void installShadows(QWidget *);
+    /** unless forced, an already created shadow is only re-created if its tiles or padding changed */
+    void installShadows(QWidget *, bool force = false);
+
+    //* true if shadow uses given tiles
+    static bool hasTiles(const KWindowShadow *, const QVector<KWindowShadowTile::Ptr> &);
 
     //* uninstalls shadow on given widget in a platform independent way
     void uninstallShadows(QWidget *);
@@ -160,15 +157,12 @@ private:
     //* managed shadows
     QMap<QWindow *, KWindowShadow *> _shadows;
 
-    //* tileset
-    TileSet _shadowTiles;
-
     //* number of tiles
     enum {
         numTiles = 8
     };
 
-    //* shared shadow tiles
-    QVector<KWindowShadowTile::Ptr> _tiles;
+    //* shadow tiles, per device pixel ratio and shadow parameters
+    QMap<ShadowTilesKey, ShadowTiles> _shadowTiles;
 };
 }
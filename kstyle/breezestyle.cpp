@@ -14,6 +14,7 @@
 #include "breezemdiwindowshadow.h"
 #include "breezemetrics.h"
 #include "breezemnemonics.h"
+#include "breezeprofiler.h"
 #include "breezepropertynames.h"
 #include "breezeshadowhelper.h"
 #include "breezesplitterproxy.h"
@@ -333,18 +334,27 @@ Style::~Style()
 //______________________________________________________________
 void Style::polish(QWidget *widget)
 {
+    ProfileScope profileScope("polish", "Animations");
+
     if (!widget) {
         return;
     }
 
     // register widget to animations
     _animations->registerWidget(widget);
+    profileScope.next("WindowManager");
     _windowManager->registerWidget(widget);
+    profileScope.next("FrameShadowFactory");
     _frameShadowFactory->registerWidget(widget, _helper);
+    profileScope.next("MdiWindowShadowFactory");
     _mdiWindowShadowFactory->registerWidget(widget);
+    profileScope.next("ShadowHelper");
     _shadowHelper->registerWidget(widget);
+    profileScope.next("SplitterFactory");
     _splitterFactory->registerWidget(widget);
+    profileScope.next("ToolsAreaManager");
     _toolsAreaManager->registerWidget(widget);
+    profileScope.next("Style");
 
     // enable mouse over effects for all necessary widgets
     if (qobject_cast<QAbstractItemView *>(widget) || qobject_cast<QAbstractSpinBox *>(widget) || qobject_cast<QCheckBox *>(widget)
@@ -1299,6 +1309,7 @@ void Style::drawPrimitive(PrimitiveElement element, const QStyleOption *option,
         break;
     }
 
+    ProfileScope profileScope("drawPrimitive", element);
     painter->save();
 
     // call function if implemented
@@ -1457,6 +1468,7 @@ void Style::drawControl(ControlElement element, const QStyleOption *option, QPai
         }
     }
 
+    ProfileScope profileScope("drawControl", element);
     painter->save();
 
     // call function if implemented
@@ -1502,6 +1514,7 @@ void Style::drawComplexControl(ComplexControl element, const QStyleOptionComplex
         break;
     }
 
+    ProfileScope profileScope("drawComplexControl", element);
     painter->save();
 
     // call function if implemented
@@ -8999,10 +9012,29 @@ QIcon Style::titleBarButtonIcon(StandardPixmap standardPixmap, const QStyleOptio
     return icon;
 }
 
-void Style::generateDecorationColorsOnDecorationColorSettingsUpdate(QByteArray uuid)
+void Style::generateDecorationColorsOnDecorationColorSettingsUpdate(QByteArray uuid, SettingsChanges changes)
 {
-    _helper->setGenerateDecorationColorsOnDecorationColorSettingsUpdateFlag(&uuid);
-    loadConfiguration();
+    // the window decoration animation settings are not used by the application style
+    if (!(changes & (SettingsChangeColors | SettingsChangeShadow | SettingsChangeGeometry | SettingsChangeIcons | SettingsChangeExceptions))) {
+        return;
+    }
+
+    // exceptions are applied by DecorationSettingsProvider, and can change the title bar colours and opacity, so are treated as colour changes.
+    // kstyle does not receive KWin's reloadConfig, so this is the only notification of an exception change
+    // geometry and icon changes do not need the decoration colours to be regenerated
+    if (changes & (SettingsChangeColors | SettingsChangeShadow | SettingsChangeExceptions)) {
+        _helper->setGenerateDecorationColorsOnDecorationColorSettingsUpdateFlag(&uuid);
+    }
+
+    // shadow tiles and frame radii depend on the decoration shadow and corner radius, so need a full reload
+    if (changes & (SettingsChangeShadow | SettingsChangeGeometry)) {
+        loadConfiguration();
+        return;
+    }
+
+    _helper->loadConfig();
+    _toolsAreaManager->configUpdated();
+    _iconCache.clear();
 }
 
 //____________________________________________________________________
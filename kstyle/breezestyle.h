@@ -11,6 +11,7 @@
 #include "breezehelper.h"
 #include "breezemetrics.h"
 #include "config-breeze.h"
+#include "settingschangetools.h"
 
 #if BREEZE_HAVE_KSTYLE
 #include <KStyle>
@@ -159,8 +160,8 @@ protected Q_SLOTS:
     //* standard icons
     QIcon standardIconImplementation(StandardPixmap, const QStyleOption *, const QWidget *) const;
 
-    //* set flag to regenerate cache of decorationColors and update configuration
-    void generateDecorationColorsOnDecorationColorSettingsUpdate(QByteArray uuid);
+    //* set flag to regenerate cache of decorationColors and update the configuration affected by the given window decoration setting changes
+    void generateDecorationColorsOnDecorationColorSettingsUpdate(QByteArray uuid, SettingsChanges changes);
 
 protected:
     //* standard icons
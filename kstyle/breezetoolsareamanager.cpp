@@ -213,53 +213,105 @@ bool ToolsAreaManager::eventFilter(QObject *watched, QEvent *event)
     Q_ASSERT(watched);
     Q_ASSERT(event);
 
-    QPointer<QObject> parent = watched;
-    QPointer<const QMainWindow> mainWindow = nullptr;
-    while (parent != nullptr) {
-        if (qobject_cast<QMainWindow *>(parent)) {
-            mainWindow = qobject_cast<QMainWindow *>(parent);
-            break;
-        }
-        parent = parent->parent();
+    // check the event type before anything else, as this is called for every event the watched objects receive
+    const QEvent::Type type = event->type();
+    if (type != QEvent::ChildAdded && type != QEvent::ChildRemoved && type != QEvent::Move && type != QEvent::ParentChange) {
+        ++_filteredEventCount;
+        return false;
     }
 
-    if (const QMainWindow *mw = qobject_cast<QMainWindow *>(watched)) {
-        QChildEvent *ev = nullptr;
-        if (event->type() == QEvent::ChildAdded || event->type() == QEvent::ChildRemoved) {
-            ev = static_cast<QChildEvent *>(event);
-
-            if (event->type() == QEvent::ChildAdded) {
-                QChildEvent *childEvent = static_cast<QChildEvent *>(event);
-                if (QMenuBar *menuBar = qobject_cast<QMenuBar *>(childEvent->child())) {
-                    menuBar->setProperty("breeze_has_toolsarea_palette", true);
-                    menuBar->setPalette(_palette);
-                }
-            }
-        } else {
+    // the owning main window is cached at registration time
+    const auto mainWindowIt = _mainWindows.constFind(watched);
+    if (mainWindowIt == _mainWindows.cend() || mainWindowIt.value().isNull()) {
+        ++_filteredEventCount;
+        return false;
+    }
+    const QPointer<const QMainWindow> mainWindow = mainWindowIt.value();
+
+    if (mainWindow.data() == watched) {
+        if (type != QEvent::ChildAdded && type != QEvent::ChildRemoved) {
+            ++_filteredEventCount;
             return false;
         }
 
+        ++_processedEventCount;
+        QChildEvent *ev = static_cast<QChildEvent *>(event);
+        if (ev->added()) {
+            if (QMenuBar *menuBar = qobject_cast<QMenuBar *>(ev->child())) {
+                menuBar->setProperty("breeze_has_toolsarea_palette", true);
+                menuBar->setPalette(_palette);
+            }
+        }
+
         QPointer<QToolBar> tb = qobject_cast<QToolBar *>(ev->child());
         if (tb.isNull()) {
             return false;
         }
 
         if (ev->added()) {
-            if (mw->toolBarArea(tb) == Qt::TopToolBarArea) {
-                appendIfNotAlreadyExists(mw, tb);
+            if (mainWindow->toolBarArea(tb) == Qt::TopToolBarArea) {
+                appendIfNotAlreadyExists(mainWindow, tb);
             }
         } else if (ev->removed()) {
-            removeWindowToolBar(mw, tb);
+            removeWindowToolBar(mainWindow, tb);
         }
-    } else if (qobject_cast<QToolBar *>(watched)) {
-        if (!mainWindow.isNull()) {
-            tryUnregisterToolBar(mainWindow, qobject_cast<QWidget *>(watched));
+    } else if (type == QEvent::Move) {
+        // toolbars are only cached if they were toolbars at registration time
+        ++_processedEventCount;
+        tryUnregisterToolBar(mainWindow, static_cast<QWidget *>(watched));
+    } else if (type == QEvent::ParentChange) {
+        ++_processedEventCount;
+        QWidget *widget = static_cast<QWidget *>(watched);
+        tryUnregisterToolBar(mainWindow, widget);
+
+        // a reparented toolbar may now belong to another main window, or to none
+        const QMainWindow *newMainWindow = owningMainWindow(widget);
+        if (newMainWindow == mainWindow.data()) {
+            return false;
+        }
+        removeWindowToolBar(mainWindow, qobject_cast<QToolBar *>(widget));
+        if (newMainWindow) {
+            _mainWindows.insert(watched, newMainWindow);
+            tryRegisterToolBar(newMainWindow, widget);
+        } else {
+            _mainWindows.remove(watched);
         }
+    } else {
+        ++_filteredEventCount;
     }
 
     return false;
 }
 
+void ToolsAreaManager::cacheMainWindow(QObject *object, const QMainWindow *window)
+{
+    connect(object, &QObject::destroyed, this, &ToolsAreaManager::uncacheMainWindow, Qt::UniqueConnection);
+    _mainWindows.insert(object, window);
+    object->installEventFilter(this);
+}
+
+void ToolsAreaManager::uncacheMainWindow(QObject *object)
+{
+    _mainWindows.remove(object);
+}
+
+const QMainWindow *ToolsAreaManager::owningMainWindow(const QWidget *widget) const
+{
+    const QMainWindow *mainWindow = nullptr;
+    for (const QWidget *parent = widget; parent != nullptr; parent = parent->parentWidget()) {
+        if (qobject_cast<const QMdiArea *>(parent) || qobject_cast<const QDockWidget *>(parent)) {
+            break;
+        }
+        if (auto window = qobject_cast<const QMainWindow *>(parent)) {
+            mainWindow = window;
+        }
+    }
+    if (mainWindow == nullptr || mainWindow != mainWindow->window()) {
+        return nullptr;
+    }
+    return mainWindow;
+}
+
 void ToolsAreaManager::registerWidget(QWidget *widget)
 {
     Q_ASSERT(widget);
@@ -268,6 +320,8 @@ void ToolsAreaManager::registerWidget(QWidget *widget)
     QPointer<const QMainWindow> mainWindow = qobject_cast<QMainWindow *>(ptr);
 
     if (mainWindow && mainWindow.data() == mainWindow->window()) {
+        cacheMainWindow(widget, mainWindow);
+
         const auto toolBars = mainWindow->findChildren<QToolBar *>(QString(), Qt::FindDirectChildrenOnly);
         for (auto *toolBar : toolBars) {
             tryRegisterToolBar(mainWindow, toolBar);
@@ -281,22 +335,12 @@ void ToolsAreaManager::registerWidget(QWidget *widget)
         return;
     }
 
-    auto parent = ptr;
-
-    while (parent != nullptr) {
-        if (qobject_cast<QMdiArea *>(parent) || qobject_cast<QDockWidget *>(parent)) {
-            break;
-        }
-        if (auto window = qobject_cast<QMainWindow *>(parent)) {
-            mainWindow = window;
-        }
-        parent = parent->parentWidget();
-    }
+    mainWindow = owningMainWindow(widget);
     if (mainWindow == nullptr) {
         return;
     }
-    if (mainWindow.data() != mainWindow->window()) {
-        return;
+    if (qobject_cast<QToolBar *>(widget)) {
+        cacheMainWindow(widget, mainWindow);
     }
     tryRegisterToolBar(mainWindow, widget);
 }
@@ -309,6 +353,9 @@ void ToolsAreaManager::unregisterWidget(QWidget *widget)
         widget->setPalette({});
     }
 
+    widget->removeEventFilter(this);
+    uncacheMainWindow(widget);
+
     auto ptr = QPointer<QWidget>(widget);
 
     if (QPointer<const QMainWindow> window = qobject_cast<QMainWindow *>(ptr)) {
@@ -3,7 +3,9 @@
 #include "breezehelper.h"
 #include "breezestyle.h"
 #include <KSharedConfig>
+#include <QHash>
 #include <QObject>
+#include <QPointer>
 
 namespace Breeze
 {
@@ -22,6 +24,10 @@ private:
         QVector<QPointer<QToolBar>> toolBars;
     };
     std::vector<WindowToolBars> _windows;
+    //* owning main window of registered main windows and toolbars, used by the event filter
+    QHash<const QObject *, QPointer<const QMainWindow>> _mainWindows;
+    quint64 _processedEventCount = 0;
+    quint64 _filteredEventCount = 0;
     QPalette _palette = QPalette();
     bool _colorSchemeHasHeaderColor;
     bool _translucent = false;
@@ -30,6 +36,11 @@ private:
     void appendIfNotAlreadyExists(const QMainWindow *window, const QPointer<QToolBar> &toolBar);
     void removeWindowToolBar(const QMainWindow *window, const QPointer<QToolBar> &toolBar);
     void removeWindow(const QMainWindow *window);
+    void cacheMainWindow(QObject *object, const QMainWindow *window);
+    void uncacheMainWindow(QObject *object);
+
+    //* the top-level main window the widget belongs to, if any
+    const QMainWindow *owningMainWindow(const QWidget *widget) const;
 
     friend class AppListener;
 
@@ -45,6 +56,18 @@ public:
 
     bool eventFilter(QObject *watched, QEvent *event) override;
 
+    //* number of events handled by the event filter
+    quint64 processedEventCount() const
+    {
+        return _processedEventCount;
+    }
+
+    //* number of events discarded by the event filter before any processing
+    quint64 filteredEventCount() const
+    {
+        return _filteredEventCount;
+    }
+
     const QPalette &palette() const
     {
         return _palette;
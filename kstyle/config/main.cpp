@@ -12,10 +12,11 @@
 #include "breeze.h"
 #include "dbusmessages.h"
 #include "presetsmodel.h"
-#include "systemicongenerator.h"
+#include "systemicongenerationjob.h"
 #include <QAbstractScrollArea>
 #include <QApplication>
 #include <QCommandLineParser>
+#include <QElapsedTimer>
 #include <QIcon>
 
 #include <KCMultiDialog>
@@ -155,13 +156,13 @@ CommandLineProcessResult processComandLine(QApplication &app, QCommandLineParser
 
     if (parser.isSet(generateIcons) || parser.isSet(loadWindecoPresetOption)) {
         commandSet = true;
-        InternalSettingsPtr internalSettings = InternalSettingsPtr(new InternalSettings());
-        internalSettings->load();
 
         // auto-generate the klassy and klassy-dark system icons
-        SystemIconGenerator iconGenerator(internalSettings);
-        iconGenerator.generate();
-        output << i18n("klassy and klassy-dark system icons generated.") << Qt::endl;
+        QElapsedTimer timer;
+        timer.start();
+        g_systemIconGenerationJob.start();
+        g_systemIconGenerationJob.waitForFinished();
+        output << i18n("klassy and klassy-dark system icons generated in %1 ms.", timer.elapsed()) << Qt::endl;
     }
 
     if (commandSet) {
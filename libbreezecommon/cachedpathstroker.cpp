@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#include "cachedpathstroker.h"
+
+#include <functional>
+#include <unordered_map>
+
+namespace Breeze
+{
+
+namespace
+{
+struct StrokeCacheKey {
+    StrokeCacheKey(const QPainterPath &path, const QPen &pen)
+        : path(path)
+        , width(pen.widthF())
+        , capStyle(pen.capStyle())
+        , joinStyle(pen.joinStyle())
+        , miterLimit(pen.miterLimit())
+        , style(pen.style())
+        , dashOffset(pen.dashOffset())
+    {
+        hash = std::hash<int>()(path.fillRule());
+        combine(width);
+        combine(capStyle);
+        combine(joinStyle);
+        combine(miterLimit);
+        combine(style);
+        combine(dashOffset);
+        for (int i = 0; i < path.elementCount(); ++i) {
+            const QPainterPath::Element element(path.elementAt(i));
+            combine(element.type);
+            combine(element.x);
+            combine(element.y);
+        }
+    }
+
+    //* exact comparison, as QPainterPath::operator== is fuzzy and a stroke must only be reused for the very same path
+    bool operator==(const StrokeCacheKey &other) const
+    {
+        if (hash != other.hash || width != other.width || capStyle != other.capStyle || joinStyle != other.joinStyle || miterLimit != other.miterLimit
+            || style != other.style || dashOffset != other.dashOffset || path.fillRule() != other.path.fillRule()
+            || path.elementCount() != other.path.elementCount()) {
+            return false;
+        }
+        for (int i = 0; i < path.elementCount(); ++i) {
+            const QPainterPath::Element element(path.elementAt(i));
+            const QPainterPath::Element otherElement(other.path.elementAt(i));
+            if (element.type != otherElement.type || element.x != otherElement.x || element.y != otherElement.y) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    QPainterPath path;
+    qreal width;
+    Qt::PenCapStyle capStyle;
+    Qt::PenJoinStyle joinStyle;
+    qreal miterLimit;
+    Qt::PenStyle style;
+    qreal dashOffset;
+    std::size_t hash;
+
+private:
+    template<typename T>
+    void combine(const T &value)
+    {
+        hash ^= std::hash<T>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+};
+
+struct StrokeCacheKeyHash {
+    std::size_t operator()(const StrokeCacheKey &key) const
+    {
+        return key.hash;
+    }
+};
+
+// icon shapes are few, so the cache is only emptied if it grows beyond them, e.g. from many different scale factors
+constexpr std::size_t maximumStrokeCacheSize = 256;
+
+thread_local std::unordered_map<StrokeCacheKey, QPainterPath, StrokeCacheKeyHash> strokeCache;
+}
+
+CachedPathStroker::CachedPathStroker(const QPen &pen)
+    : m_stroker(pen)
+    , m_pen(pen)
+{
+}
+
+QPainterPath CachedPathStroker::createStroke(const QPainterPath &path) const
+{
+    // custom dash patterns are not part of the key
+    if (m_pen.style() == Qt::CustomDashLine) {
+        return m_stroker.createStroke(path);
+    }
+
+    StrokeCacheKey key(path, m_pen);
+    const auto it = strokeCache.find(key);
+    if (it != strokeCache.end()) {
+        return it->second;
+    }
+
+    if (strokeCache.size() >= maximumStrokeCacheSize) {
+        strokeCache.clear();
+    }
+
+    const QPainterPath stroke(m_stroker.createStroke(path));
+    strokeCache.emplace(std::move(key), stroke);
+    return stroke;
+}
+
+}
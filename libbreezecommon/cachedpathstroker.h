@@ -0,0 +1,39 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#pragma once
+
+#include "breezecommon_export.h"
+
+#include <QPainterPath>
+#include <QPainterPathStroker>
+#include <QPen>
+
+namespace Breeze
+{
+
+/**
+ * @brief Drop-in replacement for QPainterPathStroker that memoises the strokes it creates.
+ *        Button icon outlines only depend on the icon style, button type, checked state and pen,
+ *        so the same few paths are stroked on every repaint. Strokes are keyed on the exact path elements and the
+ *        stroke parameters of the pen, so a cached stroke is identical to a freshly created one. The cache is per thread.
+ */
+class BREEZECOMMON_EXPORT CachedPathStroker
+{
+public:
+    explicit CachedPathStroker(const QPen &pen);
+
+    /**
+     * @brief Returns the stroke of the given path, from the cache if it was already stroked with the same pen parameters.
+     */
+    QPainterPath createStroke(const QPainterPath &path) const;
+
+private:
+    QPainterPathStroker m_stroker;
+    QPen m_pen;
+};
+
+}
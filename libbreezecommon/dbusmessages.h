@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include "settingschangetools.h"
+
 #include <QDBusConnection>
 #include <QDBusMessage>
 
@@ -37,11 +39,13 @@ public:
         QDBusConnection::sessionBus().send(message);
     }
 
-    static void updateDecorationColorCache()
+    // the changed categories are sent so that listeners only redo the affected stages of a reconfiguration
+    static void updateDecorationColorCache(SettingsChanges changes = SettingsChangeAll)
     {
         QDBusMessage message(QDBusMessage::createSignal(QStringLiteral("/KlassyDecoration"),
                                                         QStringLiteral("org.kde.Klassy.Style"),
                                                         QStringLiteral("updateDecorationColorCache")));
+        message.setArguments(QList{QVariant(uint(changes))});
         QDBusConnection::sessionBus().send(message);
     }
 
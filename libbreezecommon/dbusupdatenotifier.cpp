@@ -14,6 +14,11 @@ DBusUpdateNotifier g_dBusUpdateNotifier;
 
 DBusUpdateNotifier::DBusUpdateNotifier()
 {
+    // Plasma emits several of these notifications in a burst when a global theme or colour scheme is applied
+    m_coalesceTimer.setSingleShot(true);
+    m_coalesceTimer.setInterval(m_coalesceInterval);
+    connect(&m_coalesceTimer, &QTimer::timeout, this, &DBusUpdateNotifier::onCoalesceTimeout);
+
     QDBusConnection dBusConnection = QDBusConnection::sessionBus();
 
     dBusConnection.connect(
@@ -29,7 +34,7 @@ DBusUpdateNotifier::DBusUpdateNotifier()
                            QStringLiteral("org.kde.Klassy.Style"),
                            QStringLiteral("updateDecorationColorCache"),
                            this,
-                           SLOT(onWindowDecorationSettingsUpdate()));
+                           SLOT(onWindowDecorationSettingsUpdate(uint)));
 
     dBusConnection.connect(QString(),
                            QStringLiteral("/plasma_org_kde_plasma_desktop_appletsrc"),
@@ -39,23 +44,84 @@ DBusUpdateNotifier::DBusUpdateNotifier()
                            SLOT(onAppletSettingsUpdate()));
 }
 
-void DBusUpdateNotifier::onWindowDecorationSettingsUpdate()
+void DBusUpdateNotifier::onWindowDecorationSettingsUpdate(uint changes)
 {
-    Q_EMIT decorationSettingsUpdate(QUuid::createUuid().toByteArray());
+    m_decorationSettingsUpdatePending = true;
+    m_pendingDecorationSettingsChanges |= SettingsChanges(QFlag(int(changes)));
+    scheduleUpdate();
 }
 
 void DBusUpdateNotifier::onSystemSettingUpdate(QString first, QString second, QDBusVariant third)
 {
     Q_UNUSED(third);
     if (first == QStringLiteral("org.freedesktop.appearance") && second == QStringLiteral("color-scheme")) { // third is an int
-        Q_EMIT systemColorSchemeUpdate(QUuid::createUuid().toByteArray());
+        m_systemColorSchemeUpdatePending = true;
+        scheduleUpdate();
     } else if (first == QStringLiteral("org.gnome.desktop.interface") && second == QStringLiteral("icon-theme")) { // third is a string with the icon theme name
-        Q_EMIT systemIconsUpdate();
+        m_systemIconsUpdatePending = true;
+        scheduleUpdate();
     }
 }
 
 void DBusUpdateNotifier::onAppletSettingsUpdate()
 {
-    Q_EMIT appletSettingsUpdate(QUuid::createUuid().toByteArray());
+    m_appletSettingsUpdatePending = true;
+    scheduleUpdate();
+}
+
+void DBusUpdateNotifier::scheduleUpdate()
+{
+    m_rawNotificationCount++;
+
+    // the first notification of a burst is emitted straight away, so that it keeps its order relative to other signals sent with it,
+    // e.g. KWin's reloadConfig which Decoration::reconfigureOnSettingsChange follows.
+    // Later notifications of the burst are held until the end of the coalescing interval.
+    // The timer is not restarted by them, so that a long burst cannot delay the update indefinitely
+    if (!m_coalesceTimer.isActive()) {
+        m_coalesceTimer.start(); // started first, as a receiver may process events and so receive further notifications
+        emitPendingUpdates();
+    }
+}
+
+void DBusUpdateNotifier::onCoalesceTimeout()
+{
+    // while the burst continues, keep holding its notifications to one update of each kind per interval
+    if (emitPendingUpdates()) {
+        m_coalesceTimer.start();
+    }
+}
+
+bool DBusUpdateNotifier::emitPendingUpdates()
+{
+    const quint64 previousCoalescedNotificationCount(m_coalescedNotificationCount);
+
+    // the pending state is reset before emitting, as a receiver may process events and so receive further notifications
+    if (m_decorationSettingsUpdatePending) {
+        const SettingsChanges changes(m_pendingDecorationSettingsChanges);
+        m_decorationSettingsUpdatePending = false;
+        m_pendingDecorationSettingsChanges = SettingsChangeNone;
+        m_coalescedNotificationCount++;
+        Q_EMIT decorationSettingsUpdate(QUuid::createUuid().toByteArray(), changes);
+    }
+
+    if (m_systemColorSchemeUpdatePending) {
+        m_systemColorSchemeUpdatePending = false;
+        m_coalescedNotificationCount++;
+        Q_EMIT systemColorSchemeUpdate(QUuid::createUuid().toByteArray());
+    }
+
+    if (m_systemIconsUpdatePending) {
+        m_systemIconsUpdatePending = false;
+        m_coalescedNotificationCount++;
+        Q_EMIT systemIconsUpdate();
+    }
+
+    if (m_appletSettingsUpdatePending) {
+        m_appletSettingsUpdatePending = false;
+        m_coalescedNotificationCount++;
+        Q_EMIT appletSettingsUpdate(QUuid::createUuid().toByteArray());
+    }
+
+    return m_coalescedNotificationCount != previousCoalescedNotificationCount;
 }
 }
@@ -8,12 +8,15 @@
 
 #include "breeze.h"
 #include "breezecommon_export.h"
+#include "settingschangetools.h"
 #include <QDBusVariant>
 #include <QString>
+#include <QTimer>
 
 namespace Breeze
 {
 
+//* receives the D-Bus notifications of settings updates, coalescing those following the first of a burst into a single update of each kind
 class BREEZECOMMON_EXPORT DBusUpdateNotifier : public QObject
 {
     Q_OBJECT
@@ -21,16 +24,51 @@ class BREEZECOMMON_EXPORT DBusUpdateNotifier : public QObject
 public:
     DBusUpdateNotifier();
 
+    //* number of relevant D-Bus notifications received
+    quint64 rawNotificationCount() const
+    {
+        return m_rawNotificationCount;
+    }
+
+    //* number of updates emitted for them after coalescing
+    quint64 coalescedNotificationCount() const
+    {
+        return m_coalescedNotificationCount;
+    }
+
 public Q_SLOTS:
-    void onWindowDecorationSettingsUpdate();
+    void onWindowDecorationSettingsUpdate(uint changes);
     void onSystemSettingUpdate(QString, QString, QDBusVariant);
     void onAppletSettingsUpdate();
 
 Q_SIGNALS:
-    void decorationSettingsUpdate(QByteArray uuid);
+    void decorationSettingsUpdate(QByteArray uuid, SettingsChanges changes);
     void systemColorSchemeUpdate(QByteArray uuid);
     void systemIconsUpdate();
     void appletSettingsUpdate(QByteArray uuid);
+
+private:
+    //* counts a notification and emits it at once if no coalescing interval is running, starting one
+    void scheduleUpdate();
+
+    //* emits the notifications held during the coalescing interval, starting another interval if there were any
+    void onCoalesceTimeout();
+
+    //* emits one signal for each kind of pending update, returning whether there were any
+    bool emitPendingUpdates();
+
+    //* notifications arriving within this interval (ms) of an emitted update are held and emitted together at its end
+    static constexpr int m_coalesceInterval = 100;
+    QTimer m_coalesceTimer;
+
+    bool m_decorationSettingsUpdatePending = false;
+    SettingsChanges m_pendingDecorationSettingsChanges; // union of the changes of all the pending notifications
+    bool m_systemColorSchemeUpdatePending = false;
+    bool m_systemIconsUpdatePending = false;
+    bool m_appletSettingsUpdatePending = false;
+
+    quint64 m_rawNotificationCount = 0;
+    quint64 m_coalescedNotificationCount = 0;
 };
 
 extern DBusUpdateNotifier BREEZECOMMON_EXPORT g_dBusUpdateNotifier;
@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2014 Martin Gräßlin <mgraesslin@kde.org>
+ * SPDX-FileCopyrightText: 2014 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ * SPDX-FileCopyrightText: 2018 Vlad Zahorodnii <vlad.zahorodnii@kde.org>
+ * SPDX-FileCopyrightText: 2021-2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#include "decorationshadowrenderer.h"
+#include "breezeboxshadowrenderer.h"
+#include "colortools.h"
+#include "geometrytools.h"
+
+#include <QPainter>
+
+#include <cmath>
+
+namespace Breeze
+{
+
+DecorationShadowTexture DecorationShadowRenderer::render(const CompositeShadowParams &params,
+                                                         const QColor &shadowColor,
+                                                         qreal cornerRadius,
+                                                         Corners maskCorners,
+                                                         const DecorationShadowOutline &outline)
+{
+    qreal shadow1Radius = params.shadow1.radius;
+    qreal shadow2Radius = params.shadow2.radius;
+
+    QSize boxSize =
+        BoxShadowRenderer::calculateMinimumBoxSize(std::round(shadow1Radius)).expandedTo(BoxShadowRenderer::calculateMinimumBoxSize(std::round(shadow2Radius)));
+
+    BoxShadowRenderer shadowRenderer;
+
+    shadowRenderer.setBorderRadius((cornerRadius + 0.5));
+    shadowRenderer.setBoxSize(boxSize);
+    shadowRenderer.addShadow(params.shadow1.offset, shadow1Radius, ColorTools::alphaMix(shadowColor, params.shadow1.opacity));
+    shadowRenderer.addShadow(params.shadow2.offset, shadow2Radius, ColorTools::alphaMix(shadowColor, params.shadow2.opacity));
+
+    DecorationShadowTexture texture;
+    texture.image = shadowRenderer.render();
+
+    QPainter painter(&texture.image);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    const QRect outerRect = texture.image.rect();
+
+    QRect boxRect(QPoint(0, 0), boxSize);
+    boxRect.moveCenter(outerRect.center());
+
+    qreal shadowOverlap = Metrics::Decoration_Shadow_Overlap;
+    qreal shadowOffsetX = params.offset.x();
+    qreal shadowOffsetY = params.offset.y();
+
+    // Mask out inner rect.
+    texture.padding = QMargins(boxRect.left() - outerRect.left() - shadowOverlap - shadowOffsetX,
+                               boxRect.top() - outerRect.top() - shadowOverlap - shadowOffsetY,
+                               outerRect.right() - boxRect.right() - shadowOverlap + shadowOffsetX,
+                               outerRect.bottom() - boxRect.bottom() - shadowOverlap + shadowOffsetY);
+
+    const QRectF innerRect = outerRect - texture.padding;
+
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(Qt::black);
+    painter.setCompositionMode(QPainter::CompositionMode_DestinationOut);
+
+    painter.drawPath(GeometryTools::roundedPath(innerRect, maskCorners, (cornerRadius + 0.5)));
+
+    // Draw Thin window outline
+    if (outline.color.isValid()) {
+        QPen p;
+        p.setColor(outline.color);
+        // use a miter join rather than the default bevel join to get sharp corners at low radii
+        if (outline.squareCorners)
+            p.setJoinStyle(Qt::MiterJoin);
+
+        qreal outlinePenWidthWithOverlap = outline.penWidth + outline.overlap;
+
+        qreal halfOutlinePenWidth = outline.penWidth / 2;
+        qreal outlineAdjustment = halfOutlinePenWidth - outline.overlap;
+        QRectF outlineRect;
+        outlineRect =
+            innerRect.adjusted(-outlineAdjustment,
+                               -outlineAdjustment,
+                               outlineAdjustment,
+                               outlineAdjustment); // make thin window outline rect larger so most is outside the window, except for a 0.5px scaled overlap
+        p.setWidthF(outlinePenWidthWithOverlap);
+        painter.setPen(p);
+        painter.setBrush(Qt::NoBrush);
+        painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+
+        qreal outlineCornerRadius;
+
+        if (outline.squareCorners)
+            outlineCornerRadius = cornerRadius; // give a square corner for when corner radius is 0
+        else
+            outlineCornerRadius = cornerRadius + halfOutlinePenWidth; // else round corner slightly more to account for pen width
+
+        painter.drawPath(GeometryTools::roundedPath(outlineRect, outline.corners, outlineCornerRadius, outline.sides, outline.penWidth));
+    }
+    painter.end();
+
+    texture.innerShadowRect = QRect(outerRect.center(), QSize(1, 1));
+    return texture;
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2014 Martin Gräßlin <mgraesslin@kde.org>
+ * SPDX-FileCopyrightText: 2014 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ * SPDX-FileCopyrightText: 2018 Vlad Zahorodnii <vlad.zahorodnii@kde.org>
+ * SPDX-FileCopyrightText: 2021-2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#pragma once
+
+#include "breeze.h"
+#include "breezecommon_export.h"
+#include "shadowparams.h"
+
+#include <QColor>
+#include <QImage>
+#include <QMargins>
+#include <QRect>
+
+namespace Breeze
+{
+
+/**
+ * @brief The thin window outline drawn into the window decoration shadow texture
+ */
+struct DecorationShadowOutline {
+    //* no outline is drawn if invalid
+    QColor color;
+    qreal penWidth = 0;
+    //* width of the outline drawn behind the window, so that the anti-aliasing blends with the window
+    qreal overlap = 0;
+    //* square corners with a miter join, for when the window corner radius is 0
+    bool squareCorners = false;
+    Corners corners = AllCorners;
+    Sides sides = AllSides;
+};
+
+/**
+ * @brief A window decoration shadow texture, with the geometry to give to KDecoration3::DecorationShadow
+ */
+struct DecorationShadowTexture {
+    QImage image;
+    QMargins padding;
+    QRect innerShadowRect;
+};
+
+/**
+ * @brief Renders the window decoration shadow texture.
+ *        To be used by both the window decoration and its benchmark.
+ */
+class BREEZECOMMON_EXPORT DecorationShadowRenderer
+{
+public:
+    /**
+     * @brief Renders the box shadows, masks out the window and draws the thin window outline
+     * @param params the shadow parameters, already scaled
+     * @param shadowColor the colour of the shadows, whose opacity is mixed with that of each shadow
+     * @param cornerRadius the scaled window corner radius
+     * @param maskCorners the window corners that are rounded
+     * @param outline the thin window outline
+     */
+    static DecorationShadowTexture
+    render(const CompositeShadowParams &params, const QColor &shadowColor, qreal cornerRadius, Corners maskCorners, const DecorationShadowOutline &outline);
+};
+
+}
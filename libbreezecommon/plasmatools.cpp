@@ -6,73 +6,120 @@
 #include "plasmatools.h"
 
 #include <KConfig>
+#include <KConfigGroup>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QMutex>
+#include <QStandardPaths>
+
 #include <map>
 
 namespace Breeze
 {
 
-Side PlasmaTools::taskManagerSide(const bool dotIfIconsOnlyTaskManager)
-{
-    KConfig plasmaAppletsConfig(QStringLiteral("plasma-org.kde.plasma.desktop-appletsrc"), KConfig::OpenFlag::SimpleConfig);
+//* the task manager sides parsed from the Plasma applets config, and the state of the file they were parsed from
+struct TaskManagerSides {
+    QString filePath;
+    QDateTime lastModified;
+    qint64 size = -1;
+    bool parsed = false;
 
-    if (!plasmaAppletsConfig.hasGroup(QStringLiteral("Containments"))) {
-        return SideBottom;
-    }
-    KConfigGroup containments = plasmaAppletsConfig.group(QStringLiteral("Containments"));
+    Side side = SideBottom;
+    Side sideDotIfIconsOnly = SideBottom;
+};
+
+static QMutex g_taskManagerSidesMutex;
+static TaskManagerSides g_taskManagerSides;
+
+//* a panel containing a task manager applet, in file order
+struct TaskPanel {
+    int screen;
+    int location;
+    bool iconsOnly;
+};
 
+static Side taskManagerSideFromPanels(const QList<TaskPanel> &taskPanels, const bool dotIfIconsOnlyTaskManager)
+{
     std::map<int, int> taskPanelScreenAndLocation; // screen, location; auto-sorts by screen priority
 
-    for (QString &containmentGroupString : containments.groupList()) {
-        if (containments.group(containmentGroupString).readEntry(QStringLiteral("plugin"), QString()) == QStringLiteral("org.kde.panel")) {
-            if (!containments.group(containmentGroupString).hasGroup(QStringLiteral("Applets")))
-                return SideBottom;
-
-            KConfigGroup panelAppletsGroup = containments.group(containmentGroupString).group(QStringLiteral("Applets"));
-            for (QString &panelAppletsString : panelAppletsGroup.groupList()) {
-                if (panelAppletsGroup.group(panelAppletsString).readEntry(QStringLiteral("plugin"), QString())
-                    == QStringLiteral("org.kde.plasma.taskmanager")) {
-                    int location = containments.group(containmentGroupString).readEntry(QStringLiteral("location"), -1);
-                    if (location >= 0) {
-                        int screen = containments.group(containmentGroupString).readEntry(QStringLiteral("lastScreen"), -1);
-                        if (screen >= 0 && !taskPanelScreenAndLocation.contains(screen)) {
-                            taskPanelScreenAndLocation.insert({screen, location});
-                        }
-                    }
-                } else if (panelAppletsGroup.group(panelAppletsString).readEntry(QStringLiteral("plugin"), QString())
-                           == QStringLiteral("org.kde.plasma.icontasks")) {
-                    int location;
-                    if (dotIfIconsOnlyTaskManager)
-                        location = 0;
-                    else
-                        location = containments.group(containmentGroupString).readEntry(QStringLiteral("location"), -1);
-                    if (location >= 0) {
-                        int screen = containments.group(containmentGroupString).readEntry(QStringLiteral("lastScreen"), -1);
-                        if (screen >= 0 && !taskPanelScreenAndLocation.contains(screen)) {
-                            taskPanelScreenAndLocation.insert({screen, location});
-                        }
-                    }
-                } else if (panelAppletsGroup.group(panelAppletsString).readEntry(QStringLiteral("plugin"), QString())
-                           == QStringLiteral("org.kde.plasma.windowlist")) {
-                    int location = containments.group(containmentGroupString).readEntry(QStringLiteral("location"), -1);
-                    if (location >= 0) {
-                        int screen = containments.group(containmentGroupString).readEntry(QStringLiteral("lastScreen"), -1);
-                        if (screen >= 0 && !taskPanelScreenAndLocation.contains(screen)) {
-                            taskPanelScreenAndLocation.insert({screen, location});
-                        }
-                    }
-                }
-            }
+    for (const TaskPanel &taskPanel : taskPanels) {
+        const int location = (taskPanel.iconsOnly && dotIfIconsOnlyTaskManager) ? 0 : taskPanel.location;
+        if (location >= 0 && taskPanel.screen >= 0 && !taskPanelScreenAndLocation.contains(taskPanel.screen)) {
+            taskPanelScreenAndLocation.insert({taskPanel.screen, location});
         }
     }
 
     if (taskPanelScreenAndLocation.size()) {
         auto it = taskPanelScreenAndLocation.begin();
-        return (panelLocationToSide(it->second)); // use only the highest priority screen to determine the taskmanager location
+        return (PlasmaTools::panelLocationToSide(it->second)); // use only the highest priority screen to determine the taskmanager location
     }
 
     return SideBottom;
 }
 
+//* reads the applets config in a single pass, returning the sides both with and without dotIfIconsOnlyTaskManager
+static void parseTaskManagerSides(const QString &filePath, Side &side, Side &sideDotIfIconsOnly)
+{
+    side = SideBottom;
+    sideDotIfIconsOnly = SideBottom;
+
+    KConfig plasmaAppletsConfig(filePath, KConfig::OpenFlag::SimpleConfig);
+
+    if (!plasmaAppletsConfig.hasGroup(QStringLiteral("Containments"))) {
+        return;
+    }
+    const KConfigGroup containments = plasmaAppletsConfig.group(QStringLiteral("Containments"));
+
+    QList<TaskPanel> taskPanels;
+    const QStringList containmentGroupStrings = containments.groupList();
+    for (const QString &containmentGroupString : containmentGroupStrings) {
+        const KConfigGroup containment = containments.group(containmentGroupString);
+        if (containment.readEntry(QStringLiteral("plugin"), QString()) != QStringLiteral("org.kde.panel")) {
+            continue;
+        }
+        if (!containment.hasGroup(QStringLiteral("Applets")))
+            return; // SideBottom
+
+        const int location = containment.readEntry(QStringLiteral("location"), -1);
+        const int screen = containment.readEntry(QStringLiteral("lastScreen"), -1);
+
+        const KConfigGroup panelAppletsGroup = containment.group(QStringLiteral("Applets"));
+        const QStringList panelAppletsStrings = panelAppletsGroup.groupList();
+        for (const QString &panelAppletsString : panelAppletsStrings) {
+            const QString plugin = panelAppletsGroup.group(panelAppletsString).readEntry(QStringLiteral("plugin"), QString());
+            if (plugin == QStringLiteral("org.kde.plasma.taskmanager") || plugin == QStringLiteral("org.kde.plasma.windowlist")) {
+                taskPanels.append(TaskPanel{screen, location, false});
+            } else if (plugin == QStringLiteral("org.kde.plasma.icontasks")) {
+                taskPanels.append(TaskPanel{screen, location, true});
+            }
+        }
+    }
+
+    side = taskManagerSideFromPanels(taskPanels, false);
+    sideDotIfIconsOnly = taskManagerSideFromPanels(taskPanels, true);
+}
+
+Side PlasmaTools::taskManagerSide(const bool dotIfIconsOnlyTaskManager)
+{
+    // the same file as KConfig opens for the SimpleConfig name
+    const QString filePath(QStandardPaths::writableLocation(QStandardPaths::GenericConfigLocation)
+                           + QStringLiteral("/plasma-org.kde.plasma.desktop-appletsrc"));
+    const QFileInfo fileInfo(filePath);
+
+    // only re-read the file if it has changed since it was last parsed
+    QMutexLocker locker(&g_taskManagerSidesMutex);
+    if (!g_taskManagerSides.parsed || g_taskManagerSides.filePath != filePath || g_taskManagerSides.lastModified != fileInfo.lastModified()
+        || g_taskManagerSides.size != fileInfo.size()) {
+        g_taskManagerSides.filePath = filePath;
+        g_taskManagerSides.lastModified = fileInfo.lastModified();
+        g_taskManagerSides.size = fileInfo.size();
+        parseTaskManagerSides(filePath, g_taskManagerSides.side, g_taskManagerSides.sideDotIfIconsOnly);
+        g_taskManagerSides.parsed = true;
+    }
+
+    return dotIfIconsOnlyTaskManager ? g_taskManagerSides.sideDotIfIconsOnly : g_taskManagerSides.side;
+}
+
 Side PlasmaTools::panelLocationToSide(const int panelLocation)
 {
     switch (panelLocation) {
@@ -19,6 +19,7 @@ namespace Breeze
 class BREEZECOMMON_EXPORT PlasmaTools
 {
 public:
+    //* the side of the task manager on the highest priority screen. The applets config is only re-read when it has changed since the last call
     static Side taskManagerSide(const bool dotIfIconsOnlyTaskManager = false);
     static Side panelLocationToSide(const int panelLocation);
 };
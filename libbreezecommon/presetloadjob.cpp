@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+#include "presetloadjob.h"
+#include "breeze.h"
+#include "dbusmessages.h"
+#include "presetsmodel.h"
+#include "systemicongenerationjob.h"
+
+#include <QCoreApplication>
+
+namespace Breeze
+{
+
+PresetLoadJob g_presetLoadJob;
+
+PresetLoadJob::PresetLoadJob()
+{
+    m_threadPool.setMaxThreadCount(1);
+}
+
+PresetLoadJob::~PresetLoadJob()
+{
+    // a load is not cancelled part way through, so as not to leave a partially written configuration
+    m_threadPool.waitForDone();
+}
+
+void PresetLoadJob::start(const QString &presetName, bool writeKwinBorderConfig)
+{
+    ++m_running;
+
+    m_threadPool.start([this, presetName, writeKwinBorderConfig]() {
+        // the configuration objects are opened in this thread, as KSharedConfig instances are per thread
+        KSharedConfig::Ptr config(KSharedConfig::openConfig(QStringLiteral("klassy/klassyrc")));
+        KSharedConfig::Ptr presetsConfig(KSharedConfig::openConfig(QStringLiteral("klassy/windecopresetsrc")));
+        PresetsModel::importBundledPresets(presetsConfig.data());
+
+        InternalSettingsPtr internalSettings(new InternalSettings());
+        internalSettings->load();
+        const bool loaded(PresetsModel::loadPresetAndSave(internalSettings.data(), config.data(), presetsConfig.data(), presetName, writeKwinBorderConfig));
+
+        QMetaObject::invokeMethod(
+            this,
+            [this, loaded]() {
+                onRunFinished(loaded);
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+void PresetLoadJob::waitForFinished()
+{
+    m_threadPool.waitForDone();
+    // deliver the queued onRunFinished() calls
+    QCoreApplication::sendPostedEvents(this, QEvent::MetaCall);
+}
+
+void PresetLoadJob::onRunFinished(bool loaded)
+{
+    --m_running;
+    if (loaded) {
+        DBusMessages::updateDecorationColorCache();
+        DBusMessages::kwinReloadConfig();
+        g_systemIconGenerationJob.start();
+    }
+    Q_EMIT finished(loaded);
+}
+
+}
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#pragma once
+
+#include "breezecommon_export.h"
+
+#include <QObject>
+#include <QThreadPool>
+
+namespace Breeze
+{
+
+/**
+ * @brief Loads a window decoration preset into klassyrc and kwinrc on a background thread of the current process
+ *
+ * The bundled presets are imported first. Once a preset is loaded, KWin and the application style are told to reload their configuration
+ * and the system icons are regenerated, from the thread of g_presetLoadJob, i.e. the main thread.
+ * Requests are run one after the other, in the order they are made.
+ */
+class BREEZECOMMON_EXPORT PresetLoadJob : public QObject
+{
+    Q_OBJECT
+
+public:
+    PresetLoadJob();
+    ~PresetLoadJob() override;
+
+    /**
+     * @brief Requests the loading of a preset
+     * @param presetName the name of the preset in windecopresetsrc
+     * @param writeKwinBorderConfig whether to also write the border size and button positions of the preset to kwinrc
+     */
+    void start(const QString &presetName, bool writeKwinBorderConfig);
+
+    /**
+     * @brief Blocks until all the requested loads have finished
+     */
+    void waitForFinished();
+
+    bool isRunning() const
+    {
+        return m_running > 0;
+    }
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when a requested load has finished
+     * @param loaded false if the preset could not be loaded
+     */
+    void finished(bool loaded);
+
+private:
+    void onRunFinished(bool loaded);
+
+    //* a single thread, so that loads do not write the configuration files concurrently
+    QThreadPool m_threadPool;
+    int m_running = 0;
+};
+
+extern PresetLoadJob BREEZECOMMON_EXPORT g_presetLoadJob;
+
+}
@@ -9,6 +9,10 @@
 #include <QDir>
 #include <QRegularExpression>
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace Breeze
 {
 
@@ -78,13 +82,41 @@ void PresetsModel::writeSkeletonItemToConfigGroup(KConfigSkeletonItem *item, KCo
 }
 
 bool PresetsModel::loadPreset(KCoreConfigSkeleton *skeleton, KConfig *presetsConfig, const QString &presetName, bool writeKwinBorderConfig)
+{
+    const std::optional<ParsedPreset> preset(parsePreset(presetsConfig, presetName));
+    if (!preset) {
+        return false;
+    }
+
+    applyPreset(skeleton, *preset);
+
+    // writes the value of KwinBorderSize from the preset into the kwinrc file
+    if (writeKwinBorderConfig) {
+        QString groupName = presetGroupName(presetName);
+        KConfigGroup configGroup = presetsConfig->group(groupName);
+        if (configGroup.hasKey(QStringLiteral("KwinBorderSize"))) {
+            writeBorderSizeToKwinConfig(configGroup.readEntry(QStringLiteral("KwinBorderSize")));
+        }
+        if (configGroup.hasKey(QStringLiteral("KwinButtonsOnLeft")) && configGroup.hasKey(QStringLiteral("KwinButtonsOnRight"))) {
+            writeButtonPositionToKwinConfig(configGroup.readEntry(QStringLiteral("KwinButtonsOnLeft")),
+                                            configGroup.readEntry(QStringLiteral("KwinButtonsOnRight")));
+        }
+    }
+
+    return true;
+}
+
+std::optional<ParsedPreset> PresetsModel::parsePreset(KConfig *presetsConfig, const QString &presetName)
 {
     QString groupName = presetGroupName(presetName);
 
     if (groupName.isEmpty() || !presetsConfig->hasGroup(groupName))
-        return false;
+        return std::nullopt;
 
-    for (KConfigSkeletonItem *item : skeleton->items()) {
+    // the items read the preset group into a scratch skeleton, so that enums and int lists are converted as when reading the main config
+    ParsedPreset preset;
+    InternalSettings internalSettings;
+    for (KConfigSkeletonItem *item : internalSettings.items()) {
         QString originalGroup = item->group();
         if (originalGroup == QStringLiteral("Exceptions") || originalGroup == QStringLiteral("Global")) {
             continue;
@@ -92,21 +124,44 @@ bool PresetsModel::loadPreset(KCoreConfigSkeleton *skeleton, KConfig *presetsCon
         item->setGroup(groupName);
         item->readConfig(presetsConfig);
         item->setGroup(originalGroup);
+        preset.properties.insert(item->name(), item->property());
     }
 
-    // writes the value of KwinBorderSize from the preset into the kwinrc file
-    if (writeKwinBorderConfig) {
-        KConfigGroup configGroup = presetsConfig->group(groupName);
-        if (configGroup.hasKey(QStringLiteral("KwinBorderSize"))) {
-            writeBorderSizeToKwinConfig(configGroup.readEntry(QStringLiteral("KwinBorderSize")));
+    KConfigGroup configGroup = presetsConfig->group(groupName);
+    if (configGroup.hasKey(QStringLiteral("KwinBorderSize"))) {
+        preset.hasKwinBorderSize = true;
+        const QString kwinBorderSize(configGroup.readEntry(QStringLiteral("KwinBorderSize")));
+        const auto choiceList = static_cast<KCoreConfigSkeleton::ItemEnum *>(internalSettings.findItem(QStringLiteral("BorderSize")))->choices();
+        for (int i = 0; i < choiceList.count(); i++) { // need to convert the string value of the enum value to an int for compatibility
+            if (choiceList[i].name == kwinBorderSize)
+                preset.kwinBorderSize = i;
         }
-        if (configGroup.hasKey(QStringLiteral("KwinButtonsOnLeft")) && configGroup.hasKey(QStringLiteral("KwinButtonsOnRight"))) {
-            writeButtonPositionToKwinConfig(configGroup.readEntry(QStringLiteral("KwinButtonsOnLeft")),
-                                            configGroup.readEntry(QStringLiteral("KwinButtonsOnRight")));
+    }
+
+    return preset;
+}
+
+void PresetsModel::applyPreset(KCoreConfigSkeleton *skeleton, const ParsedPreset &preset)
+{
+    const auto items = skeleton->items();
+    for (KConfigSkeletonItem *item : items) {
+        const auto property = preset.properties.constFind(item->name());
+        if (property != preset.properties.cend()) {
+            item->setProperty(property.value());
         }
     }
+}
 
-    return true;
+void PresetsModel::applyKwinBorderSizeToException(InternalSettings *internalSettings, const ParsedPreset &preset)
+{
+    if (internalSettings->exceptionBorder() || !preset.hasKwinBorderSize) {
+        return;
+    }
+
+    if (preset.kwinBorderSize >= 0) {
+        internalSettings->setBorderSize(preset.kwinBorderSize);
+    }
+    internalSettings->setExceptionBorder(true);
 }
 
 bool PresetsModel::loadPresetAndSave(KCoreConfigSkeleton *skeleton,
@@ -222,7 +277,7 @@ void PresetsModel::deleteBundledPresets(KConfig *presetsConfig)
 QStringList PresetsModel::readPresetsList(KConfig *presetsConfig)
 {
     QStringList presetsList;
-    QRegularExpression re("^Windeco Preset (.+)");
+    static const QRegularExpression re("^Windeco Preset (.+)");
     for (const QString &group : presetsConfig->groupList()) {
         QRegularExpressionMatch match = re.match(group);
         if (match.hasMatch()) {
@@ -296,12 +351,20 @@ void PresetsModel::exportPreset(KConfig *presetsConfig, const QString &presetNam
 PresetsErrorFlag
 PresetsModel::importPreset(KConfig *presetsConfig, const QString &filePath, QString &presetName, QString &error, bool forceInvalidVersion, bool markAsBundled)
 {
-    KSharedConfig::Ptr importPresetConfig = KSharedConfig::openConfig(filePath);
+    // SimpleConfig, as the preset file is read once and should not be merged with kdeglobals
+    KConfig importPresetConfig(filePath, KConfig::SimpleConfig);
 
-    if (!importPresetConfig)
-        return PresetsErrorFlag::InvalidGlobalGroup;
+    PresetsErrorFlag validationErrors = validatePresetFile(&importPresetConfig, presetName, error, forceInvalidVersion);
+    if (validationErrors != PresetsErrorFlag::None) {
+        return validationErrors;
+    }
 
-    // perform validation first
+    writeImportedPreset(presetsConfig, &importPresetConfig, presetName, markAsBundled);
+    return PresetsErrorFlag::None;
+}
+
+PresetsErrorFlag PresetsModel::validatePresetFile(KConfig *importPresetConfig, QString &presetName, QString &error, bool forceInvalidVersion)
+{
     if (!(importPresetConfig->hasGroup("Klassy Window Decoration Preset File")))
         return PresetsErrorFlag::InvalidGlobalGroup;
     KConfigGroup importGlobalGroup = importPresetConfig->group("Klassy Window Decoration Preset File");
@@ -310,16 +373,14 @@ PresetsModel::importPreset(KConfig *presetsConfig, const QString &filePath, QStr
     if (!versionValid && !forceInvalidVersion)
         return PresetsErrorFlag::InvalidVersion;
 
-    QStringList presetsList = readPresetsList(importPresetConfig.data());
+    QStringList presetsList = readPresetsList(importPresetConfig);
     if (presetsList.count())
         presetName = presetsList[0];
     else {
         return PresetsErrorFlag::InvalidGroup;
     }
 
-    QString importGroupName = presetGroupName(presetName);
-
-    KConfigGroup importGroup = importPresetConfig->group(importGroupName);
+    KConfigGroup importGroup = importPresetConfig->group(presetGroupName(presetName));
 
     for (const QString &importKey : importGroup.keyList()) {
         if (!isKeyValid(importKey)) {
@@ -328,42 +389,50 @@ PresetsModel::importPreset(KConfig *presetsConfig, const QString &filePath, QStr
         }
     }
 
-    // end of validation
+    return PresetsErrorFlag::None;
+}
 
+void PresetsModel::writeImportedPreset(KConfig *presetsConfig, KConfig *importPresetConfig, const QString &presetName, bool markAsBundled)
+{
     // delete an existing preset if has the same name
-    if (isPresetPresent(presetsConfig, presetName)) {
-        deletePreset(presetsConfig, presetName);
-    }
+    deletePreset(presetsConfig, presetName);
 
-    // start writing the values
-    auto internalSettings = InternalSettingsPtr(new InternalSettings());
-    KConfigGroup configGroup(presetsConfig, importGroupName);
+    QString groupName = presetGroupName(presetName);
+    KConfigGroup importGroup = importPresetConfig->group(groupName);
+    KConfigGroup configGroup(presetsConfig, groupName);
 
-    for (const QString &importKey : importGroup.keyList()) {
-        QString importProperty = importGroup.readEntry(importKey);
-        configGroup.writeEntry(importKey, importProperty);
+    const QMap<QString, QString> entries = importGroup.entryMap();
+    for (auto it = entries.cbegin(); it != entries.cend(); ++it) {
+        configGroup.writeEntry(it.key(), it.value());
     }
 
     if (markAsBundled)
         configGroup.writeEntry("BundledPreset", "true");
-
-    return PresetsErrorFlag::None;
 }
 
 bool PresetsModel::isKeyValid(const QString &key)
 {
-    auto internalSettings = InternalSettingsPtr(new InternalSettings());
+    return validKeys().contains(key);
+}
 
-    for (const auto &item : internalSettings->items()) {
-        if (item->key() == key) {
-            return true;
+const QSet<QString> &PresetsModel::validKeys()
+{
+    // built once, on first use, from the keys of all the settings items
+    static const QSet<QString> keys = []() {
+        QSet<QString> keys;
+        InternalSettings internalSettings;
+        for (const auto &item : internalSettings.items()) {
+            keys.insert(item->key());
         }
-    }
 
-    if (key == "KwinBorderSize" || key == "KwinButtonsOnLeft" || key == "KwinButtonsOnRight")
-        return true; // additional valid key containing KWin border size setting from kwinrc
+        // additional valid keys containing the KWin border size and button position settings from kwinrc
+        keys.insert(QStringLiteral("KwinBorderSize"));
+        keys.insert(QStringLiteral("KwinButtonsOnLeft"));
+        keys.insert(QStringLiteral("KwinButtonsOnRight"));
+        return keys;
+    }();
 
-    return false;
+    return keys;
 }
 
 // copies bundled presets in /usr/lib64/qt6/plugins/org.kde.kdecoration3.kcm/klassydecoration/presets into ~/.config/klassy/klassyrc once per release
@@ -381,10 +450,8 @@ void PresetsModel::importBundledPresets(KConfig *presetsConfig)
 
     // qDebug() << "librarypaths: " << QCoreApplication::libraryPaths(); //librarypaths:  ("/usr/lib64/qt6/plugins", "/usr/bin")
 
-    // delete bundled presets from a previous release first
-    // if the user modified the preset it will not contain the BundledPreset flag and hence won't be deleted
-    PresetsModel::deleteBundledPresets(presetsConfig);
-
+    // validate all the bundled presets before writing any, so that they are written and synced together
+    std::vector<std::pair<QString, std::unique_ptr<KConfig>>> validPresets;
     for (QString libraryPath : QCoreApplication::libraryPaths()) {
         libraryPath += "/org.kde.kdecoration3.kcm/klassydecoration/presets";
         QDir presetsDir(libraryPath);
@@ -396,17 +463,26 @@ void PresetsModel::importBundledPresets(KConfig *presetsConfig)
 
             for (QString presetFile : presetFiles) {
                 presetFile = libraryPath + "/" + presetFile; // set absolute full path
+                auto importPresetConfig = std::make_unique<KConfig>(presetFile, KConfig::SimpleConfig);
                 QString presetName;
                 QString error;
 
-                PresetsErrorFlag importErrors = PresetsModel::importPreset(presetsConfig, presetFile, presetName, error, false, true);
-                if (importErrors != PresetsErrorFlag::None) {
+                if (validatePresetFile(importPresetConfig.get(), presetName, error, false) != PresetsErrorFlag::None) {
                     continue;
                 }
+                validPresets.emplace_back(presetName, std::move(importPresetConfig));
             }
         }
     }
 
+    // delete bundled presets from a previous release first
+    // if the user modified the preset it will not contain the BundledPreset flag and hence won't be deleted
+    PresetsModel::deleteBundledPresets(presetsConfig);
+
+    for (const auto &validPreset : validPresets) {
+        writeImportedPreset(presetsConfig, validPreset.second.get(), validPreset.first, true);
+    }
+
     KConfigGroup globalGroup = presetsConfig->group("Global");
     globalGroup.writeEntry("BundledWindecoPresetsImportedVersion", klassyLongVersion());
     presetsConfig->sync();
@@ -9,6 +9,12 @@
 #include "breeze.h"
 #include "breezecommon_export.h"
 
+#include <QHash>
+#include <QSet>
+#include <QVariant>
+
+#include <optional>
+
 namespace Breeze
 {
 
@@ -20,6 +26,18 @@ enum struct BREEZECOMMON_EXPORT PresetsErrorFlag {
     InvalidKey,
 };
 
+/**
+ * @brief A preset read from the presets file once, so that it can be applied to settings repeatedly in a single pass
+ */
+struct BREEZECOMMON_EXPORT ParsedPreset {
+    //* typed property of every setting a preset sets, by item name. Settings missing from the preset hold their defaults, as when read by the item
+    QHash<QString, QVariant> properties;
+
+    //* whether the preset has a KwinBorderSize key, and its index in the BorderSize choices, or -1 if not a valid choice
+    bool hasKwinBorderSize = false;
+    int kwinBorderSize = -1;
+};
+
 /**
  * @brief Functions to read and write Presets from/to config file within Klassy
  */
@@ -33,6 +51,15 @@ public:
     static void writeSkeletonItemToConfigGroup(KConfigSkeletonItem *item, KConfigGroup &configGroup);
     static bool loadPreset(KCoreConfigSkeleton *skeleton, KConfig *presetsConfig, const QString &presetName, bool writeKwinBorderConfig = false);
 
+    //* reads a preset into a ParsedPreset, to cache and apply with applyPreset. Returns std::nullopt if the preset is not present
+    static std::optional<ParsedPreset> parsePreset(KConfig *presetsConfig, const QString &presetName);
+
+    //* sets the preset values on all the settings of skeleton that a preset contains, without reading any config
+    static void applyPreset(KCoreConfigSkeleton *skeleton, const ParsedPreset &preset);
+
+    //* sets the BorderSize of an exception from the preset KwinBorderSize, if the exception does not set its own border size
+    static void applyKwinBorderSizeToException(InternalSettings *internalSettings, const ParsedPreset &preset);
+
     //* loadPresetAndSave method is needed because the skeleton->save() member method does not work when loadPreset is called
     static bool
     loadPresetAndSave(KCoreConfigSkeleton *skeleton, KConfig *mainConfig, KConfig *presetsConfig, const QString &presetName, bool writeKwinBorderConfig);
@@ -58,7 +85,19 @@ public:
                                          bool markAsBundled = false);
     static bool isKeyValid(const QString &key);
     static bool isEnumValueValid(const QString &key, const QString &property);
+
+    //* imports all the bundled presets not yet imported for this release, writing them with a single sync
     static void importBundledPresets(KConfig *presetsConfig);
+
+private:
+    //* the keys that may be present in a preset, built once on first use
+    static const QSet<QString> &validKeys();
+
+    //* validates an opened preset file and sets presetName. For an invalid key, error is set to the key
+    static PresetsErrorFlag validatePresetFile(KConfig *importPresetConfig, QString &presetName, QString &error, bool forceInvalidVersion);
+
+    //* writes a validated preset into presetsConfig, replacing any preset with the same name. Does not sync
+    static void writeImportedPreset(KConfig *presetsConfig, KConfig *importPresetConfig, const QString &presetName, bool markAsBundled);
 };
 
 }
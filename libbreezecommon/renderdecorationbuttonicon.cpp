@@ -213,6 +213,18 @@ void RenderDecorationButtonIcon::renderIcon(DecorationButtonType type, bool chec
     m_painter->restore();
 }
 
+QPainterPath RenderDecorationButtonIcon::polylinePath(const QPointF *points, int pointCount)
+{
+    QPainterPath path;
+    if (pointCount > 0) {
+        path.moveTo(points[0]);
+        for (int i = 1; i < pointCount; ++i) {
+            path.lineTo(points[i]);
+        }
+    }
+    return path;
+}
+
 bool RenderDecorationButtonIcon::roundedPenWidthIsOdd(const QPen &pen)
 {
     return (qRound(penWidthToDevice(pen)) % 2 != 0);
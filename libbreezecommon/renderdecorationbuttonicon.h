@@ -12,6 +12,7 @@
 
 #include <QPainter>
 #include <QPainterPath>
+#include <iterator>
 #include <memory>
 
 namespace Breeze
@@ -122,6 +123,20 @@ protected:
     virtual void renderContextHelpIcon() = 0;
     virtual void renderExcludeFromCaptureIcon() = 0;
 
+    /**
+     * @brief Returns a path made of a polyline through the given points, for use with constant point tables.
+     *
+     *@param points The polyline points
+     *@param pointCount The number of points
+     */
+    static QPainterPath polylinePath(const QPointF *points, int pointCount);
+
+    template<std::size_t N>
+    static QPainterPath polylinePath(const QPointF (&points)[N])
+    {
+        return polylinePath(points, int(N));
+    }
+
     /**
      * @brief Determines whether a rounded version of a given Pen's width is an odd number. Accounts for cosmetic/non-cosmetic pens.
      *
@@ -6,7 +6,6 @@
 
 #include "renderdecorationbuttonicon18by18.h"
 #include <QGraphicsItem>
-#include <QPainterPathStroker>
 #include <cmath>
 
 namespace Breeze
@@ -25,14 +24,12 @@ RenderDecorationButtonIcon18By18::RenderDecorationButtonIcon18By18(QPainter *pai
 /* most base methods here are KDE's default Breeze/Oxygen style -- override with other styles */
 void RenderDecorationButtonIcon18By18::renderCloseIcon()
 {
-    QVector<QPointF> line1{QPointF(5, 5), QPointF(13, 13)};
-    QVector<QPointF> line2{QPointF(13, 5), QPointF(5, 13)};
+    static constexpr QPointF line1[]{QPointF(5, 5), QPointF(13, 13)};
+    static constexpr QPointF line2[]{QPointF(13, 5), QPointF(5, 13)};
 
     if (m_strokeToFilledPath) {
-        QPainterPath path1, path2;
-        path1.addPolygon(line1);
-        path2.addPolygon(line2);
-        QPainterPathStroker stroker(m_painter->pen());
+        QPainterPath path1(polylinePath(line1)), path2(polylinePath(line2));
+        CachedPathStroker stroker(m_painter->pen());
         path1 = stroker.createStroke(path1);
         path2 = stroker.createStroke(path2);
         m_painter->setBrush(m_painter->pen().color());
@@ -40,26 +37,25 @@ void RenderDecorationButtonIcon18By18::renderCloseIcon()
         m_painter->drawPath(path1);
         m_painter->drawPath(path2);
     } else {
-        m_painter->drawPolyline(line1);
-        m_painter->drawPolyline(line2);
+        m_painter->drawPolyline(line1, std::size(line1));
+        m_painter->drawPolyline(line2, std::size(line2));
     }
 }
 
 void RenderDecorationButtonIcon18By18::renderMaximizeIcon()
 {
     // up arrow
-    QVector<QPointF> line{QPointF(4, 11), QPointF(9, 6), QPointF(14, 11)};
+    static constexpr QPointF line[]{QPointF(4, 11), QPointF(9, 6), QPointF(14, 11)};
 
     if (m_strokeToFilledPath) {
-        QPainterPath path;
-        path.addPolygon(line);
-        QPainterPathStroker stroker(m_painter->pen());
+        QPainterPath path(polylinePath(line));
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
         m_painter->setBrush(m_painter->pen().color());
         m_painter->setPen(Qt::NoPen);
         m_painter->drawPath(path);
     } else {
-        m_painter->drawPolyline(line);
+        m_painter->drawPolyline(line, std::size(line));
     }
 }
 
@@ -69,45 +65,38 @@ void RenderDecorationButtonIcon18By18::renderFloatIcon()
     pen.setJoinStyle(Qt::RoundJoin);
     m_painter->setPen(pen);
 
-    QVector<QPointF> diamond;
-    if (m_fromKstyle) { // slightly smaller diamond
-        // diamond / floating kite
-        diamond = QVector<QPointF>{QPointF(4.5, 9), QPointF(9, 4.5), QPointF(13.5, 9), QPointF(9, 13.5)};
-
-    } else {
-        // diamond / floating kite
-        diamond = QVector<QPointF>{QPointF(4, 9), QPointF(9, 4), QPointF(14, 9), QPointF(9, 14)};
-    }
+    // diamond / floating kite, slightly smaller in kstyle
+    static constexpr QPointF smallDiamond[]{QPointF(4.5, 9), QPointF(9, 4.5), QPointF(13.5, 9), QPointF(9, 13.5)};
+    static constexpr QPointF largeDiamond[]{QPointF(4, 9), QPointF(9, 4), QPointF(14, 9), QPointF(9, 14)};
+    const QPointF *diamond(m_fromKstyle ? smallDiamond : largeDiamond);
 
     if (m_strokeToFilledPath) {
-        QPainterPath path;
-        path.addPolygon(diamond);
+        QPainterPath path(polylinePath(diamond, 4));
         path.closeSubpath();
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
         m_painter->setBrush(m_painter->pen().color());
         m_painter->setPen(Qt::NoPen);
         m_painter->drawPath(path);
     } else {
-        m_painter->drawConvexPolygon(diamond);
+        m_painter->drawConvexPolygon(diamond, 4);
     }
 }
 
 void RenderDecorationButtonIcon18By18::renderMinimizeIcon()
 {
     // down arrow
-    QVector<QPointF> line{QPointF(4, 7), QPointF(9, 12), QPointF(14, 7)};
+    static constexpr QPointF line[]{QPointF(4, 7), QPointF(9, 12), QPointF(14, 7)};
 
     if (m_strokeToFilledPath) {
-        QPainterPath path;
-        path.addPolygon(line);
-        QPainterPathStroker stroker(m_painter->pen());
+        QPainterPath path(polylinePath(line));
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
         m_painter->setBrush(m_painter->pen().color());
         m_painter->setPen(Qt::NoPen);
         m_painter->drawPath(path);
     } else {
-        m_painter->drawPolyline(line);
+        m_painter->drawPolyline(line, std::size(line));
     }
 }
 
@@ -151,7 +140,7 @@ void RenderDecorationButtonIcon18By18::renderCenteredLineMinimizeIcon(bool small
     if (m_strokeToFilledPath) {
         QPainterPath path;
         path.addPolygon(line);
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
         m_painter->setBrush(m_painter->pen().color());
         m_painter->setPen(Qt::NoPen);
@@ -211,7 +200,7 @@ void RenderDecorationButtonIcon18By18::renderDynamicMinimizeIcon(bool dynamicMin
     if (m_strokeToFilledPath) {
         QPainterPath path;
         path.addPolygon(line);
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
         m_painter->setBrush(m_painter->pen().color());
         m_painter->setPen(Qt::NoPen);
@@ -299,7 +288,7 @@ void RenderDecorationButtonIcon18By18::renderShadeIcon()
         QPainterPath path1, path2;
         path1.addPolygon(line1);
         path2.addPolygon(line2);
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path1 = stroker.createStroke(path1);
         path2 = stroker.createStroke(path2);
         m_painter->setPen(Qt::NoPen);
@@ -348,7 +337,7 @@ void RenderDecorationButtonIcon18By18::renderUnShadeIcon()
         QPainterPath path1, path2;
         path1.addPolygon(line1);
         path2.addPolygon(line2);
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path1 = stroker.createStroke(path1);
         path2 = stroker.createStroke(path2);
         m_painter->setPen(Qt::NoPen);
@@ -529,7 +518,7 @@ void RenderDecorationButtonIcon18By18::renderApplicationMenuIcon()
     }
 
     if (m_strokeToFilledPath) {
-        QPainterPathStroker stroker(pen);
+        CachedPathStroker stroker(pen);
         top->setPath(stroker.createStroke(top->path()));
         middle->setPath(stroker.createStroke(middle->path()));
         bottom->setPath(stroker.createStroke(bottom->path()));
@@ -578,7 +567,7 @@ void RenderDecorationButtonIcon18By18::renderCloseIconAtSquareMaximizeSize()
         QPainterPath path1, path2;
         path1.addPolygon(line1);
         path2.addPolygon(line2);
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path1 = stroker.createStroke(path1);
         path2 = stroker.createStroke(path2);
         m_painter->setPen(Qt::NoPen);
@@ -680,7 +669,7 @@ std::pair<QRectF, qreal> RenderDecorationButtonIcon18By18::renderSquareMaximizeI
         if (m_strokeToFilledPath) {
             QPainterPath path;
             path.addRoundedRect(rect, cornerRelativePercent, cornerRelativePercent, Qt::RelativeSize);
-            QPainterPathStroker stroker(pen);
+            CachedPathStroker stroker(pen);
             path = stroker.createStroke(path);
             m_painter->setBrush(pen.color());
             m_painter->setPen(Qt::NoPen);
@@ -956,7 +945,7 @@ void RenderDecorationButtonIcon18By18::renderOverlappingWindowsIcon(bool showArr
     }
 
     if (m_strokeToFilledPath) {
-        QPainterPathStroker stroker(pen);
+        CachedPathStroker stroker(pen);
         foregroundPathItem->setBrush(pen.color());
         backgroundPathItem->setBrush(pen.color());
         foregroundPathItem->setPath(stroker.createStroke(foregroundPathItem->path()));
@@ -1126,7 +1115,7 @@ void RenderDecorationButtonIcon18By18::renderTinySquareMinimizeIcon(bool showArr
         m_painter->drawRect(rect);
         QPainterPath stroke;
         stroke.addRect(rect);
-        QPainterPathStroker stroker(pen);
+        CachedPathStroker stroker(pen);
         stroke = stroker.createStroke(stroke);
         m_painter->setBrush(pen.color());
         m_painter->drawPath(stroke);
@@ -1274,7 +1263,7 @@ void RenderDecorationButtonIcon18By18::renderKeepBehindIconAsFromBreezeIcons()
 
     if (m_strokeToFilledPath) {
         QPainterPath topPath, middlePath, bottomPath, arrowBodyPath, arrowHeadPath;
-        QPainterPathStroker stroker(pen);
+        CachedPathStroker stroker(pen);
         topPath.addPolygon(top);
         middlePath.addPolygon(middle);
         bottomPath.addPolygon(bottom);
@@ -1405,7 +1394,7 @@ void RenderDecorationButtonIcon18By18::renderKeepInFrontIconAsFromBreezeIcons()
 
     if (m_strokeToFilledPath) {
         QPainterPath topPath, middlePath, bottomPath, arrowBodyPath, arrowHeadPath;
-        QPainterPathStroker stroker(pen);
+        CachedPathStroker stroker(pen);
         topPath.addPolygon(top);
         middlePath.addPolygon(middle);
         bottomPath.addPolygon(bottom);
@@ -1453,7 +1442,7 @@ void RenderDecorationButtonIcon18By18::renderContextHelpIcon()
     path.arcTo(QRectF(6.5, 3.5, 5.5, 5), 150, -150);
     path.cubicTo(QPointF(12, 9.5), QPointF(9, 7.5), QPointF(9, 11.5));
     if (m_strokeToFilledPath) {
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
         ;
         m_painter->setPen(Qt::NoPen);
@@ -1502,7 +1491,7 @@ void RenderDecorationButtonIcon18By18::renderExcludeFromCaptureIcon()
     path.lineTo(10, 11.5);
 
     if (m_strokeToFilledPath) {
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
 
         m_painter->setPen(Qt::NoPen);
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "cachedpathstroker.h"
 #include "renderdecorationbuttonicon.h"
 #include <QGraphicsScene>
 #include <memory>
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+#include "settingschangetools.h"
+
+#include <KCoreConfigSkeleton>
+#include <QHash>
+
+namespace Breeze
+{
+
+SettingsChanges SettingsChangeTools::itemChanges(const KConfigSkeletonItem *item)
+{
+    // the main "Windeco" group mixes categories, so is classified per key
+    static const QHash<QString, SettingsChanges> windecoKeyChanges{
+        {QStringLiteral("ButtonIconStyle"), SettingsChangeIcons},
+        {QStringLiteral("IconSize"), SettingsChangeIcons},
+        {QStringLiteral("SystemIconSize"), SettingsChangeIcons},
+        {QStringLiteral("ForceColorizeSystemIcons"), SettingsChangeIcons},
+        {QStringLiteral("BoldButtonIcons"), SettingsChangeIcons},
+        {QStringLiteral("ButtonShape"), SettingsChangeGeometry | SettingsChangeColors},
+        {QStringLiteral("MatchTitleBarToApplicationColor"), SettingsChangeColors},
+        {QStringLiteral("DrawBackgroundGradient"), SettingsChangeColors},
+        {QStringLiteral("DrawTitleBarSeparator"), SettingsChangeColors},
+        {QStringLiteral("UseTitleBarColorForAllBorders"), SettingsChangeColors},
+        {QStringLiteral("ColorizeWindowOutlineWithButton"), SettingsChangeColors | SettingsChangeShadow},
+        {QStringLiteral("BoldTitle"), SettingsChangeGeometry},
+        {QStringLiteral("UnderlineTitle"), SettingsChangeGeometry},
+        {QStringLiteral("WindowCornerRadius"), SettingsChangeGeometry | SettingsChangeShadow},
+        {QStringLiteral("RoundAllCornersWhenNoBorders"), SettingsChangeGeometry | SettingsChangeShadow},
+        {QStringLiteral("DrawBorderOnMaximizedWindows"), SettingsChangeGeometry},
+        {QStringLiteral("AnimationsEnabled"), SettingsChangeAnimation},
+        {QStringLiteral("AnimationsSpeedRelativeSystem"), SettingsChangeAnimation},
+    };
+
+    // the other groups each correspond to a configuration dialog
+    static const QHash<QString, SettingsChanges> groupChanges{
+        {QStringLiteral("Global"), SettingsChangeNone}, // written by the decoration itself
+        {QStringLiteral("SystemIconGeneration"), SettingsChangeIcons},
+        {QStringLiteral("ButtonSizing"), SettingsChangeGeometry},
+        {QStringLiteral("ButtonColors"), SettingsChangeColors},
+        {QStringLiteral("ButtonBehaviour"), SettingsChangeColors},
+        {QStringLiteral("TitleBarSpacing"), SettingsChangeGeometry},
+        {QStringLiteral("TitleBarOpacity"), SettingsChangeColors},
+        {QStringLiteral("WindowOutlineStyle"), SettingsChangeColors | SettingsChangeShadow},
+        {QStringLiteral("ShadowStyle"), SettingsChangeShadow},
+        {QStringLiteral("Exceptions"), SettingsChangeExceptions},
+    };
+
+    if (item->group() == QStringLiteral("Windeco")) {
+        return windecoKeyChanges.value(item->key(), SettingsChangeAll);
+    }
+    return groupChanges.value(item->group(), SettingsChangeAll);
+}
+
+SettingsChanges SettingsChangeTools::changes(const KCoreConfigSkeleton *before, const KCoreConfigSkeleton *after)
+{
+    SettingsChanges changes;
+    const auto items = after->items();
+    for (const KConfigSkeletonItem *item : items) {
+        const KConfigSkeletonItem *previousItem(before->findItem(item->name()));
+        if (!previousItem || previousItem->property() != item->property()) {
+            changes |= itemChanges(item);
+        }
+    }
+    return changes;
+}
+
+SettingsChanges SettingsChangeTools::changes(const InternalSettingsList &before, const InternalSettingsList &after)
+{
+    if (before.size() != after.size()) {
+        return SettingsChangeExceptions;
+    }
+
+    // only the exception-specific settings are compared, as the other settings of an exception are copied from the main settings
+    for (int i = 0; i < after.size(); ++i) {
+        const auto items = after.at(i)->items();
+        for (const KConfigSkeletonItem *item : items) {
+            if (item->group() != QStringLiteral("Exceptions")) {
+                continue;
+            }
+            const KConfigSkeletonItem *previousItem(before.at(i)->findItem(item->name()));
+            if (!previousItem || previousItem->property() != item->property()) {
+                return SettingsChangeExceptions;
+            }
+        }
+    }
+    return SettingsChangeNone;
+}
+
+}
@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#pragma once
+
+#include "breeze.h"
+#include "breezecommon_export.h"
+
+#include <QFlags>
+
+class KConfigSkeletonItem;
+class KCoreConfigSkeleton;
+
+namespace Breeze
+{
+
+//* categories of window decoration settings, so that listeners to a settings change only redo the affected stages
+enum BREEZECOMMON_EXPORT SettingsChange {
+    SettingsChangeNone = 0,
+    SettingsChangeColors = 0x1,
+    SettingsChangeShadow = 0x2,
+    SettingsChangeGeometry = 0x4,
+    SettingsChangeIcons = 0x8,
+    SettingsChangeAnimation = 0x10,
+    SettingsChangeExceptions = 0x20,
+    SettingsChangeAll = SettingsChangeColors | SettingsChangeShadow | SettingsChangeGeometry | SettingsChangeIcons | SettingsChangeAnimation
+        | SettingsChangeExceptions,
+};
+
+Q_DECLARE_FLAGS(SettingsChanges, SettingsChange)
+
+/**
+ * @brief Functions to determine which categories of window decoration setting have changed between two sets of settings
+ */
+class BREEZECOMMON_EXPORT SettingsChangeTools
+{
+public:
+    /**
+     * @brief The categories affected by a change to the given setting
+     * @param item An item of InternalSettings
+     * @return The categories; SettingsChangeAll if the setting is not known
+     */
+    static SettingsChanges itemChanges(const KConfigSkeletonItem *item);
+
+    /**
+     * @brief Compares every setting of two InternalSettings
+     * @param before The previous settings
+     * @param after The new settings
+     * @return The union of the categories of all settings that differ
+     */
+    static SettingsChanges changes(const KCoreConfigSkeleton *before, const KCoreConfigSkeleton *after);
+
+    /**
+     * @brief Compares the exception-specific settings of two lists of window decoration exceptions
+     * @return SettingsChangeExceptions if any exception was added, removed or modified, otherwise SettingsChangeNone
+     */
+    static SettingsChanges changes(const InternalSettingsList &before, const InternalSettingsList &after);
+};
+
+}
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(Breeze::SettingsChanges)
@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2014 Martin Gräßlin <mgraesslin@kde.org>
+ * SPDX-FileCopyrightText: 2014 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ * SPDX-FileCopyrightText: 2018 Vlad Zahorodnii <vlad.zahorodnii@kde.org>
+ * SPDX-FileCopyrightText: 2021-2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#pragma once
+
+#include "breezesettings.h"
+
+#include <QPoint>
+
+namespace Breeze
+{
+
+//* parameters of a single box shadow
+struct ShadowParams {
+    ShadowParams()
+        : offset(QPoint(0, 0))
+        , radius(0)
+        , opacity(0)
+    {
+    }
+
+    ShadowParams(const QPoint &offset, int radius, qreal opacity)
+        : offset(offset)
+        , radius(radius)
+        , opacity(opacity)
+    {
+    }
+
+    QPoint offset;
+    int radius;
+    qreal opacity;
+
+    void operator*=(qreal factor)
+    {
+        offset *= factor;
+        radius = qRound(radius * factor);
+    }
+};
+
+//* window shadow, made of two box shadows
+struct CompositeShadowParams {
+    CompositeShadowParams() = default;
+
+    CompositeShadowParams(const QPoint &offset, const ShadowParams &shadow1, const ShadowParams &shadow2)
+        : offset(offset)
+        , shadow1(shadow1)
+        , shadow2(shadow2)
+    {
+    }
+
+    bool isNone() const
+    {
+        return qMax(shadow1.radius, shadow2.radius) == 0;
+    }
+
+    QPoint offset;
+    ShadowParams shadow1;
+    ShadowParams shadow2;
+
+    void operator*=(qreal factor)
+    {
+        offset *= factor;
+        shadow1 *= factor;
+        shadow2 *= factor;
+    }
+};
+
+//* composite window decoration shadow for each ShadowSize setting; the application style uses smaller shadows of its own
+const CompositeShadowParams s_decorationShadowParams[] = {
+    // None
+    CompositeShadowParams( // hacked in by PAM with small values except with opacity 0; this is to allow a thin window outline to be drawn without a shadow
+        QPoint(0, 4),
+        ShadowParams(QPoint(0, 0), 16, 0),
+        ShadowParams(QPoint(0, -2), 8, 0)),
+    // Small
+    CompositeShadowParams(QPoint(0, 4), ShadowParams(QPoint(0, 0), 16, 1), ShadowParams(QPoint(0, -2), 8, 0.4)),
+    // Medium
+    CompositeShadowParams(QPoint(0, 8), ShadowParams(QPoint(0, 0), 32, 0.9), ShadowParams(QPoint(0, -4), 16, 0.3)),
+    // Large
+    CompositeShadowParams(QPoint(0, 12), ShadowParams(QPoint(0, 0), 48, 0.8), ShadowParams(QPoint(0, -6), 24, 0.2)),
+    // Very large
+    CompositeShadowParams(QPoint(0, 16), ShadowParams(QPoint(0, 0), 64, 0.7), ShadowParams(QPoint(0, -8), 32, 0.1)),
+};
+
+inline CompositeShadowParams lookupDecorationShadowParams(int size)
+{
+    switch (size) {
+    case Breeze::InternalSettings::EnumShadowSize::ShadowNone:
+        return s_decorationShadowParams[0];
+    case Breeze::InternalSettings::EnumShadowSize::ShadowSmall:
+        return s_decorationShadowParams[1];
+    case Breeze::InternalSettings::EnumShadowSize::ShadowMedium:
+        return s_decorationShadowParams[2];
+    case Breeze::InternalSettings::EnumShadowSize::ShadowLarge:
+        return s_decorationShadowParams[3];
+    case Breeze::InternalSettings::EnumShadowSize::ShadowVeryLarge:
+        return s_decorationShadowParams[4];
+    default:
+        // Fallback to the Large size.
+        return s_decorationShadowParams[3];
+    }
+}
+}
@@ -6,7 +6,6 @@
 
 #include "styleark.h"
 #include <QPainterPath>
-#include <QPainterPathStroker>
 
 namespace Breeze
 {
@@ -94,7 +93,7 @@ void RenderStyleArk18By18::renderCloseIcon()
     QPen pen = m_painter->pen();
     pen.setCapStyle(Qt::PenCapStyle::RoundCap);
     pen.setWidthF(1.7);
-    QPainterPathStroker stroker(pen);
+    CachedPathStroker stroker(pen);
     QPainterPath strokedX = stroker.createStroke(x);
 
     m_painter->setPen(Qt::PenStyle::NoPen);
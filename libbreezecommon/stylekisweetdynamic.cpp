@@ -72,7 +72,7 @@ void RenderStyleKisweetDynamic18By18::renderMinimizeIcon()
     if (m_strokeToFilledPath) {
         QPainterPath path;
         path.addPolygon(line);
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
         m_painter->setBrush(m_painter->pen().color());
         m_painter->setPen(Qt::NoPen);
@@ -161,7 +161,7 @@ void RenderStyleKisweetDynamic18By18::renderShadeIcon()
     if (m_strokeToFilledPath) {
         QPainterPath path;
         path.addPolygon(line);
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
         m_painter->setBrush(m_painter->pen().color());
         m_painter->setPen(Qt::NoPen);
@@ -209,7 +209,7 @@ void RenderStyleKisweetDynamic18By18::renderUnShadeIcon()
     if (m_strokeToFilledPath) {
         QPainterPath path;
         path.addPolygon(line);
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
         m_painter->setBrush(m_painter->pen().color());
         m_painter->setPen(Qt::NoPen);
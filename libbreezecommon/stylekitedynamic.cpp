@@ -5,7 +5,6 @@
  */
 
 #include "stylekitedynamic.h"
-#include <QPainterPathStroker>
 
 namespace Breeze
 {
@@ -40,7 +39,7 @@ void RenderStyleKiteDynamic18By18::renderFloatIcon()
         QPainterPath path;
         path.addPolygon(poly);
         path.closeSubpath();
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         path = stroker.createStroke(path);
         m_painter->setBrush(m_painter->pen().color());
         m_painter->setPen(Qt::NoPen);
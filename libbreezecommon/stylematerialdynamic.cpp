@@ -5,7 +5,6 @@
  */
 
 #include "stylematerialdynamic.h"
-#include <QPainterPathStroker>
 
 namespace Breeze
 {
@@ -76,7 +75,7 @@ void RenderStyleMaterialDynamic18By18::renderFloatIcon()
     arrowPath.addPolygon(arrow);
 
     if (m_strokeToFilledPath) {
-        QPainterPathStroker stroker(m_painter->pen());
+        CachedPathStroker stroker(m_painter->pen());
         squarePath = stroker.createStroke(squarePath);
         arrowPath = stroker.createStroke(arrowPath);
         m_painter->setBrush(m_painter->pen().color());
@@ -86,14 +86,12 @@ void RenderStyleOxygen18By18::renderPinOnAllDesktopsIcon()
 
     pen.setColor(color);
     m_painter->setPen(pen);
-    QVector<QPointF> line1{QPointF(5.5, 7.5), QPointF(10.5, 12.5)};
-    QVector<QPointF> line2{QPointF(8, 10), QPointF(4.5, 13.5)};
+    static constexpr QPointF line1[]{QPointF(5.5, 7.5), QPointF(10.5, 12.5)};
+    static constexpr QPointF line2[]{QPointF(8, 10), QPointF(4.5, 13.5)};
 
     if (m_strokeToFilledPath) {
-        QPainterPath path1, path2;
-        path1.addPolygon(line1);
-        path2.addPolygon(line2);
-        QPainterPathStroker stroker(m_painter->pen());
+        QPainterPath path1(polylinePath(line1)), path2(polylinePath(line2));
+        CachedPathStroker stroker(m_painter->pen());
         path1 = stroker.createStroke(path1);
         path2 = stroker.createStroke(path2);
         m_painter->setPen(Qt::NoPen);
@@ -101,8 +99,8 @@ void RenderStyleOxygen18By18::renderPinOnAllDesktopsIcon()
         m_painter->drawPath(path1);
         m_painter->drawPath(path2);
     } else {
-        m_painter->drawPolyline(line1);
-        m_painter->drawPolyline(line2);
+        m_painter->drawPolyline(line1, std::size(line1));
+        m_painter->drawPolyline(line2, std::size(line2));
     }
 }
 
@@ -115,17 +113,13 @@ void RenderStyleOxygen18By18::renderKeepBehindIcon()
         m_painter->setPen(pen);
     }
 
-    QVector<QPointF> line1, line2;
-
     // two down arrows
-    line1 = {QPointF(4, 5), QPointF(9, 10), QPointF(14, 5)};
-    line2 = {QPointF(4, 9), QPointF(9, 14), QPointF(14, 9)};
+    static constexpr QPointF line1[]{QPointF(4, 5), QPointF(9, 10), QPointF(14, 5)};
+    static constexpr QPointF line2[]{QPointF(4, 9), QPointF(9, 14), QPointF(14, 9)};
 
     if (m_strokeToFilledPath) {
-        QPainterPath path1, path2;
-        path1.addPolygon(line1);
-        path2.addPolygon(line2);
-        QPainterPathStroker stroker(m_painter->pen());
+        QPainterPath path1(polylinePath(line1)), path2(polylinePath(line2));
+        CachedPathStroker stroker(m_painter->pen());
         path1 = stroker.createStroke(path1);
         path2 = stroker.createStroke(path2);
         m_painter->setBrush(m_painter->pen().color());
@@ -133,8 +127,8 @@ void RenderStyleOxygen18By18::renderKeepBehindIcon()
         m_painter->drawPath(path1);
         m_painter->drawPath(path2);
     } else {
-        m_painter->drawPolyline(line1);
-        m_painter->drawPolyline(line2);
+        m_painter->drawPolyline(line1, std::size(line1));
+        m_painter->drawPolyline(line2, std::size(line2));
     }
 }
 
@@ -147,17 +141,13 @@ void RenderStyleOxygen18By18::renderKeepInFrontIcon()
         m_painter->setPen(pen);
     }
 
-    QVector<QPointF> line1, line2;
-
     // two up arrows
-    line1 = {QPointF(4, 9), QPointF(9, 4), QPointF(14, 9)};
-    line2 = {QPointF(4, 13), QPointF(9, 8), QPointF(14, 13)};
+    static constexpr QPointF line1[]{QPointF(4, 9), QPointF(9, 4), QPointF(14, 9)};
+    static constexpr QPointF line2[]{QPointF(4, 13), QPointF(9, 8), QPointF(14, 13)};
 
     if (m_strokeToFilledPath) {
-        QPainterPath path1, path2;
-        path1.addPolygon(line1);
-        path2.addPolygon(line2);
-        QPainterPathStroker stroker(m_painter->pen());
+        QPainterPath path1(polylinePath(line1)), path2(polylinePath(line2));
+        CachedPathStroker stroker(m_painter->pen());
         path1 = stroker.createStroke(path1);
         path2 = stroker.createStroke(path2);
         m_painter->setBrush(m_painter->pen().color());
@@ -165,8 +155,8 @@ void RenderStyleOxygen18By18::renderKeepInFrontIcon()
         m_painter->drawPath(path1);
         m_painter->drawPath(path2);
     } else {
-        m_painter->drawPolyline(line1);
-        m_painter->drawPolyline(line2);
+        m_painter->drawPolyline(line1, std::size(line1));
+        m_painter->drawPolyline(line2, std::size(line2));
     }
 }
 
@@ -0,0 +1,279 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "svgiconwriter.h"
+
+#include <QPaintEngine>
+#include <QPainterPath>
+#include <QStringBuilder>
+#include <QTransform>
+
+#include <cmath>
+
+namespace Breeze
+{
+
+//* paint engine for SvgIconWriter. Primitives are converted to paths, mapped to device coordinates and written as path elements
+class SvgIconPaintEngine : public QPaintEngine
+{
+public:
+    SvgIconPaintEngine()
+        : QPaintEngine(QPaintEngine::AllFeatures)
+    {
+    }
+
+    bool begin(QPaintDevice *device) override
+    {
+        m_writer = static_cast<SvgIconWriter *>(device);
+        m_pen = QPen();
+        m_brush = QBrush();
+        m_transform = QTransform();
+        m_opacity = 1.0;
+        return true;
+    }
+
+    bool end() override
+    {
+        m_writer = nullptr;
+        return true;
+    }
+
+    void updateState(const QPaintEngineState &state) override
+    {
+        const QPaintEngine::DirtyFlags flags(state.state());
+        if (flags & DirtyPen) {
+            m_pen = state.pen();
+        }
+        if (flags & DirtyBrush) {
+            m_brush = state.brush();
+        }
+        if (flags & DirtyTransform) {
+            m_transform = state.transform();
+        }
+        if (flags & DirtyOpacity) {
+            m_opacity = state.opacity();
+        }
+    }
+
+    void drawPath(const QPainterPath &path) override
+    {
+        writePath(path, m_brush.style() != Qt::NoBrush);
+    }
+
+    void drawPolygon(const QPointF *points, int pointCount, PolygonDrawMode mode) override
+    {
+        if (pointCount < 2) {
+            return;
+        }
+
+        QPainterPath path(points[0]);
+        for (int i = 1; i < pointCount; ++i) {
+            path.lineTo(points[i]);
+        }
+        if (mode != PolylineMode) {
+            path.closeSubpath();
+        }
+        path.setFillRule(mode == OddEvenMode ? Qt::OddEvenFill : Qt::WindingFill);
+
+        writePath(path, mode != PolylineMode && m_brush.style() != Qt::NoBrush);
+    }
+
+    //* icons are vector-only
+    void drawPixmap(const QRectF &, const QPixmap &, const QRectF &) override
+    {
+    }
+
+    Type type() const override
+    {
+        return QPaintEngine::User;
+    }
+
+private:
+    void writePath(const QPainterPath &path, const bool fill)
+    {
+        const bool stroke(m_pen.style() != Qt::NoPen);
+        if (!m_writer || path.isEmpty() || (!fill && !stroke)) {
+            return; // invisible paths are not written
+        }
+
+        QString fillAttributes;
+        if (fill) {
+            fillAttributes = QStringLiteral("fill=\"") % m_writer->colorName(m_brush.color()) % QStringLiteral("\"");
+            const qreal fillOpacity(m_brush.color().alphaF() * m_opacity);
+            if (fillOpacity < 1.0) {
+                fillAttributes += QStringLiteral(" fill-opacity=\"") % number(fillOpacity) % QStringLiteral("\"");
+            }
+            if (path.fillRule() == Qt::OddEvenFill) {
+                fillAttributes += QStringLiteral(" fill-rule=\"evenodd\"");
+            }
+        } else {
+            fillAttributes = QStringLiteral("fill=\"none\"");
+        }
+
+        QString strokeAttributes;
+        if (stroke) {
+            qreal width(m_pen.widthF());
+            if (width == 0) {
+                width = 1;
+            } else if (!m_pen.isCosmetic()) {
+                width *= std::sqrt(std::abs(m_transform.determinant()));
+            }
+
+            strokeAttributes = QStringLiteral(" stroke=\"") % m_writer->colorName(m_pen.color()) % QStringLiteral("\" stroke-width=\"") % number(width)
+                % QStringLiteral("\" stroke-linecap=\"") % lineCap() % QStringLiteral("\" stroke-linejoin=\"") % lineJoin() % QStringLiteral("\"");
+            if (m_pen.joinStyle() == Qt::MiterJoin || m_pen.joinStyle() == Qt::SvgMiterJoin) {
+                strokeAttributes += QStringLiteral(" stroke-miterlimit=\"") % number(m_pen.miterLimit()) % QStringLiteral("\"");
+            }
+            const qreal strokeOpacity(m_pen.color().alphaF() * m_opacity);
+            if (strokeOpacity < 1.0) {
+                strokeAttributes += QStringLiteral(" stroke-opacity=\"") % number(strokeOpacity) % QStringLiteral("\"");
+            }
+            if (m_pen.style() != Qt::SolidLine) {
+                // dash pattern is in units of the pen width
+                QStringList dashes;
+                const auto dashPattern = m_pen.dashPattern();
+                for (const qreal dash : dashPattern) {
+                    dashes.append(number(dash * width));
+                }
+                strokeAttributes += QStringLiteral(" stroke-dasharray=\"") % dashes.join(QLatin1Char(',')) % QStringLiteral("\"");
+            }
+        }
+
+        m_writer->addPath(pathData(m_transform.map(path)), fillAttributes, strokeAttributes);
+    }
+
+    static QString pathData(const QPainterPath &path)
+    {
+        QString data;
+        for (int i = 0; i < path.elementCount(); ++i) {
+            const QPainterPath::Element element(path.elementAt(i));
+            switch (element.type) {
+            case QPainterPath::MoveToElement:
+                data += QLatin1Char('M');
+                break;
+            case QPainterPath::LineToElement:
+                data += QLatin1Char('L');
+                break;
+            case QPainterPath::CurveToElement:
+                data += QLatin1Char('C');
+                break;
+            case QPainterPath::CurveToDataElement:
+                data += QLatin1Char(' ');
+                break;
+            }
+            data += number(element.x) % QLatin1Char(' ') % number(element.y);
+        }
+        return data;
+    }
+
+    QString lineCap() const
+    {
+        switch (m_pen.capStyle()) {
+        case Qt::FlatCap:
+            return QStringLiteral("butt");
+        case Qt::RoundCap:
+            return QStringLiteral("round");
+        case Qt::SquareCap:
+        default:
+            return QStringLiteral("square");
+        }
+    }
+
+    QString lineJoin() const
+    {
+        switch (m_pen.joinStyle()) {
+        case Qt::RoundJoin:
+            return QStringLiteral("round");
+        case Qt::BevelJoin:
+            return QStringLiteral("bevel");
+        case Qt::MiterJoin:
+        case Qt::SvgMiterJoin:
+        default:
+            return QStringLiteral("miter");
+        }
+    }
+
+    static QString number(qreal value)
+    {
+        return QString::number(value, 'g', 6);
+    }
+
+    SvgIconWriter *m_writer = nullptr;
+    QPen m_pen;
+    QBrush m_brush;
+    QTransform m_transform;
+    qreal m_opacity = 1.0;
+};
+
+SvgIconWriter::SvgIconWriter(const QSize &size, int resolution)
+    : m_size(size)
+    , m_resolution(resolution)
+    , m_engine(std::make_unique<SvgIconPaintEngine>())
+{
+}
+
+SvgIconWriter::~SvgIconWriter() = default;
+
+QPaintEngine *SvgIconWriter::paintEngine() const
+{
+    return m_engine.get();
+}
+
+int SvgIconWriter::metric(PaintDeviceMetric metric) const
+{
+    switch (metric) {
+    case PdmWidth:
+        return m_size.width();
+    case PdmHeight:
+        return m_size.height();
+    case PdmWidthMM:
+        return qRound(m_size.width() * 25.4 / m_resolution);
+    case PdmHeightMM:
+        return qRound(m_size.height() * 25.4 / m_resolution);
+    case PdmDpiX:
+    case PdmDpiY:
+    case PdmPhysicalDpiX:
+    case PdmPhysicalDpiY:
+        return m_resolution;
+    case PdmNumColors:
+        return 0xffffffff;
+    case PdmDepth:
+        return 32;
+    default:
+        return QPaintDevice::metric(metric);
+    }
+}
+
+void SvgIconWriter::addPath(const QString &pathData, const QString &fillAttributes, const QString &strokeAttributes)
+{
+    const QString element(QStringLiteral("    <path") % (m_useCurrentColor ? QStringLiteral(" class=\"ColorScheme-Text\" ") : QStringLiteral(" ")) % fillAttributes
+                          % strokeAttributes % QStringLiteral(" d=\"") % pathData % QStringLiteral("\"/>\n"));
+    m_body += element.toUtf8();
+}
+
+QString SvgIconWriter::colorName(const QColor &color) const
+{
+    if (m_useCurrentColor && color.name() == m_colorSchemeTextColor.name()) {
+        return QStringLiteral("currentColor");
+    }
+    return color.name();
+}
+
+QByteArray SvgIconWriter::svg() const
+{
+    const QString header(QStringLiteral("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n")
+                         % QStringLiteral("<svg width=\"") % QString::number(m_size.width() * 25.4 / m_resolution) % QStringLiteral("mm\" height=\"")
+                         % QString::number(m_size.height() * 25.4 / m_resolution) % QStringLiteral("mm\" viewBox=\"0 0 ") % QString::number(m_size.width())
+                         % QLatin1Char(' ') % QString::number(m_size.height())
+                         % QStringLiteral("\" xmlns=\"http://www.w3.org/2000/svg\" version=\"1.2\" baseProfile=\"tiny\">\n") % QStringLiteral("    <desc>")
+                         % m_description.toHtmlEscaped() % QStringLiteral("</desc>\n")
+                         % QStringLiteral("    <style id=\"current-color-scheme\" type=\"text/css\">.ColorScheme-Text {color:") % m_colorSchemeTextColor.name()
+                         % QStringLiteral(";}</style>\n"));
+
+    return header.toUtf8() + m_body + QByteArrayLiteral("</svg>\n");
+}
+
+}
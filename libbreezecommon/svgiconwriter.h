@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QColor>
+#include <QPaintDevice>
+#include <QSize>
+#include <QString>
+
+#include <memory>
+
+namespace Breeze
+{
+
+class SvgIconPaintEngine;
+
+//* a paint device that writes the paths painted onto it directly as a final SVG icon document
+/**
+unlike QSvgGenerator, every element carries its own resolved colours and coordinates,
+invisible paths are never written and the colour-scheme class used by KIconLoader is added as the icon is painted,
+so that the output does not need to be re-parsed and rewritten
+*/
+class SvgIconWriter : public QPaintDevice
+{
+public:
+    //* size is the viewBox size in pixels, resolution in dots per inch
+    SvgIconWriter(const QSize &size, int resolution);
+    ~SvgIconWriter() override;
+
+    //* description element text
+    void setDescription(const QString &description)
+    {
+        m_description = description;
+    }
+
+    //* text colour of the current-color-scheme style element
+    /**
+    if useCurrentColor is set, every element is given the ColorScheme-Text class
+    and fills and strokes of this colour are replaced with currentColor, so that KIconLoader can replace them from the current colour scheme
+    */
+    void setColorSchemeTextColor(const QColor &color, bool useCurrentColor)
+    {
+        m_colorSchemeTextColor = color;
+        m_useCurrentColor = useCurrentColor;
+    }
+
+    //* the complete SVG document. Call after painting has ended
+    QByteArray svg() const;
+
+    QPaintEngine *paintEngine() const override;
+
+protected:
+    int metric(PaintDeviceMetric metric) const override;
+
+private:
+    friend class SvgIconPaintEngine;
+
+    //* add a path element, with attributes already in device coordinates
+    void addPath(const QString &pathData, const QString &fillAttributes, const QString &strokeAttributes);
+
+    //* colour attribute value, replaced with currentColor if it is the colour scheme text colour
+    QString colorName(const QColor &color) const;
+
+    QSize m_size;
+    int m_resolution;
+    QString m_description;
+    QColor m_colorSchemeTextColor;
+    bool m_useCurrentColor = false;
+
+    //* path elements
+    QByteArray m_body;
+
+    std::unique_ptr<SvgIconPaintEngine> m_engine;
+};
+
+}
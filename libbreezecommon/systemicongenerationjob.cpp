@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+#include "systemicongenerationjob.h"
+#include "breeze.h"
+#include "systemicongenerator.h"
+
+#include <QCoreApplication>
+#include <QGuiApplication>
+
+namespace Breeze
+{
+
+SystemIconGenerationJob g_systemIconGenerationJob;
+
+SystemIconGenerationJob::SystemIconGenerationJob()
+{
+    m_threadPool.setMaxThreadCount(1);
+}
+
+SystemIconGenerationJob::~SystemIconGenerationJob()
+{
+    cancel();
+    m_threadPool.waitForDone();
+}
+
+void SystemIconGenerationJob::start()
+{
+    if (m_running) {
+        // the icons being generated are already out of date, so stop them and generate once more afterwards
+        m_pending = true;
+        m_cancelled = true;
+        return;
+    }
+
+    run();
+}
+
+void SystemIconGenerationJob::cancel()
+{
+    m_pending = false;
+    m_cancelled = true;
+}
+
+void SystemIconGenerationJob::waitForFinished()
+{
+    while (m_running) {
+        m_threadPool.waitForDone();
+        // deliver the queued onRunFinished(), which may start a requested generation
+        QCoreApplication::sendPostedEvents(this, QEvent::MetaCall);
+    }
+}
+
+void SystemIconGenerationJob::run()
+{
+    if (!m_quitConnected && QCoreApplication::instance()) {
+        connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, &SystemIconGenerationJob::onAboutToQuit);
+        m_quitConnected = true;
+    }
+
+    m_running = true;
+    m_pending = false;
+    m_cancelled = false;
+
+    // the palette is read here as it is not safe to read from the generating thread
+    const QPalette palette(QGuiApplication::palette());
+    m_threadPool.start([this, palette]() {
+        // read the saved settings afresh, as the requester may have saved them since the last generation
+        InternalSettingsPtr internalSettings(new InternalSettings());
+        internalSettings->load();
+
+        SystemIconGenerator iconGenerator(internalSettings, palette, &m_cancelled);
+        const bool completed(iconGenerator.generate());
+
+        QMetaObject::invokeMethod(
+            this,
+            [this, completed]() {
+                onRunFinished(completed);
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+void SystemIconGenerationJob::onAboutToQuit()
+{
+    // do not hold up quitting for a whole generation, only for the icons already being rendered.
+    // Icons are written atomically and those not written record no hash, so they are generated on the next request
+    cancel();
+    m_threadPool.waitForDone();
+}
+
+void SystemIconGenerationJob::onRunFinished(bool completed)
+{
+    m_running = false;
+    if (m_pending) {
+        run();
+        return;
+    }
+    Q_EMIT finished(completed);
+}
+
+}
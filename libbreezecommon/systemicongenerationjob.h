@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#pragma once
+
+#include "breezecommon_export.h"
+
+#include <QObject>
+#include <QThreadPool>
+
+#include <atomic>
+
+namespace Breeze
+{
+
+/**
+ * @brief Generates the klassy and klassy-dark system icons from the saved settings on a background thread of the current process
+ *
+ * Only one generation runs at a time. A request made while a generation is running cancels it, as its settings are out of date,
+ * and is coalesced with any other such requests into a single further generation.
+ * Use from the thread of g_systemIconGenerationJob, i.e. the main thread.
+ */
+class BREEZECOMMON_EXPORT SystemIconGenerationJob : public QObject
+{
+    Q_OBJECT
+
+public:
+    SystemIconGenerationJob();
+    ~SystemIconGenerationJob() override;
+
+    /**
+     * @brief Requests a generation of the system icons from the settings currently saved in klassyrc
+     */
+    void start();
+
+    /**
+     * @brief Cancels the running generation and any requested generation
+     */
+    void cancel();
+
+    /**
+     * @brief Blocks until the running generation and any requested generation have finished
+     */
+    void waitForFinished();
+
+    bool isRunning() const
+    {
+        return m_running;
+    }
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when the last requested generation has finished
+     * @param completed false if the generation was cancelled
+     */
+    void finished(bool completed);
+
+private:
+    void run();
+    void onRunFinished(bool completed);
+    void onAboutToQuit();
+
+    //* a single thread, which itself renders the icons on a pool of threads
+    QThreadPool m_threadPool;
+    std::atomic_bool m_cancelled = false;
+    bool m_running = false;
+    bool m_pending = false;
+    bool m_quitConnected = false;
+};
+
+extern SystemIconGenerationJob BREEZECOMMON_EXPORT g_systemIconGenerationJob;
+
+}
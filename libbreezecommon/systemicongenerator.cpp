@@ -0,0 +1,587 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2026 Paul A McAuley <kde@paulmcauley.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// the generator is shared by klassy-settings, the decoration and its configuration, but keeps the translations of klassy-settings
+#define TRANSLATION_DOMAIN "klassy_style_config"
+
+#include "systemicongenerator.h"
+#include "plasmatools.h"
+#include "renderdecorationbuttonicon.h"
+#include "settingschangetools.h"
+#include "svgiconwriter.h"
+#include <KLocalizedString>
+#include <KSharedConfig>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPainter>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QStringBuilder>
+#include <QThreadPool>
+#include <QVariantMap>
+
+namespace Breeze
+{
+
+SystemIconGenerator::SystemIconGenerator(InternalSettingsPtr internalSettings, const QPalette &palette, const std::atomic_bool *cancelled)
+    : m_internalSettings(internalSettings)
+    , m_palette(palette)
+    , m_cancelled(cancelled)
+    , m_svgDescription(i18n("Auto-generated by klassy-settings"))
+{
+}
+
+bool SystemIconGenerator::generate()
+{
+    if (m_internalSettings->buttonIconStyle() == InternalSettings::EnumButtonIconStyle::StyleSystemIconTheme) {
+        return true;
+    }
+
+    addSystemScales();
+
+    m_panelSide = PlasmaTools::taskManagerSide(false);
+    m_taskManagerSide = PlasmaTools::taskManagerSide(true);
+
+    QString iconsPath = QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation) % QStringLiteral("/icons");
+
+    QString lightIconsPath = iconsPath + QStringLiteral("/klassy");
+    DecorationColors decorationColorsLight(false);
+    decorationColorsLight.generateDecorationAndButtonColors(m_palette,
+                                                            m_internalSettings,
+                                                            QColor(QStringLiteral("#232629")),
+                                                            QColor(QStringLiteral("#dee0e2")),
+                                                            QColor(QStringLiteral("#232629")),
+                                                            QColor(QStringLiteral("#dee0e2")),
+                                                            "",
+                                                            true,
+                                                            true); // titlebar colours based on Breeze Light
+
+    // the icons of both themes are collected and then rendered together on the thread pool
+    QList<IconJob> jobs;
+    generateIconThemeDir(lightIconsPath, i18n("Klassy"), m_internalSettings->klassyIconThemeInherits(), decorationColorsLight, jobs);
+
+    QString darkIconsPath = iconsPath + QStringLiteral("/klassy-dark");
+    DecorationColors decorationColorsDark(false);
+    decorationColorsDark.generateDecorationAndButtonColors(m_palette,
+                                                           m_internalSettings,
+                                                           QColor(QStringLiteral("#fcfcfc")),
+                                                           QColor(QStringLiteral("#31363b")),
+                                                           QColor(QStringLiteral("#fcfcfc")),
+                                                           QColor(QStringLiteral("#31363b")),
+                                                           "",
+                                                           true,
+                                                           true); // titlebar colours based on Breeze Dark
+    generateIconThemeDir(darkIconsPath, i18n("Klassy Dark"), m_internalSettings->klassyDarkIconThemeInherits(), decorationColorsDark, jobs);
+
+    renderIcons(jobs);
+
+    // hashes are only recorded for icons that were successfully written
+    QHash<QString, QHash<QString, QByteArray>> hashes{{lightIconsPath, {}}, {darkIconsPath, {}}};
+    for (const IconJob &job : std::as_const(jobs)) {
+        if (job.succeeded) {
+            hashes[job.themeDirPath].insert(job.relativePath, job.hash);
+        }
+    }
+    for (auto it = hashes.cbegin(); it != hashes.cend(); ++it) {
+        writeHashes(it.key(), it.value());
+    }
+
+    return !isCancelled();
+}
+
+void SystemIconGenerator::renderIcons(QList<IconJob> &jobs) const
+{
+    // each icon has its own SvgIconWriter and QPainter, and only reads the settings and colours, so they can be rendered concurrently.
+    // A private pool is used as the generator can run inside another application, whose global pool it should neither fill nor wait on
+    QThreadPool threadPool;
+    // KLASSY_ICON_GENERATION_THREADS limits the number of threads, e.g. to 1 to time a sequential generation against a parallel one
+    bool maxThreadCountSet(false);
+    const int maxThreadCount(qEnvironmentVariableIntValue("KLASSY_ICON_GENERATION_THREADS", &maxThreadCountSet));
+    if (maxThreadCountSet && maxThreadCount > 0) {
+        threadPool.setMaxThreadCount(maxThreadCount);
+    }
+    for (IconJob &job : jobs) {
+        if (job.succeeded) {
+            continue;
+        }
+        threadPool.start([this, &job]() {
+            if (isCancelled()) {
+                return; // left unsucceeded, so is regenerated next time
+            }
+            const QByteArray svg(renderIcon(*job.type, job.size, job.scale, *job.decorationColors, job.blandIconColorString));
+            job.succeeded = !svg.isEmpty() && writeIfChanged(job.themeDirPath % QStringLiteral("/") % job.relativePath, svg);
+        });
+    }
+    threadPool.waitForDone();
+}
+
+void SystemIconGenerator::generateIconThemeDir(const QString themeDirPath,
+                                               const QString themeName,
+                                               const QString inherits,
+                                               const DecorationColors &decorationColors,
+                                               QList<IconJob> &jobs)
+{
+    QDir iconDir(themeDirPath);
+    iconDir.mkpath(themeDirPath);
+
+    // the index is written to a temporary file first, so that index.theme is only touched when its contents change
+    const QString newIndexPath = themeDirPath % QStringLiteral("/index.theme.new");
+    QFile::remove(newIndexPath);
+    KConfig themeIndex(newIndexPath, KConfig::SimpleConfig);
+    KConfigGroup iconThemeGroup = themeIndex.group("Icon Theme");
+    iconThemeGroup.writeEntry("Name", themeName);
+    iconThemeGroup.writeEntry("Comment", themeName + i18n(" by Paul A McAuley, auto-generated by klassy-settings"));
+    iconThemeGroup.writeEntry("DisplayDepth", "32");
+    iconThemeGroup.writeEntry("Inherits", inherits);
+    iconThemeGroup.writeEntry("Example", "folder");
+    iconThemeGroup.writeEntry("FollowsColorScheme", "true");
+
+    iconThemeGroup.writeEntry("DesktopDefault", "48");
+    iconThemeGroup.writeEntry("DesktopSizes", "16,22,32,48,64,128,256");
+    iconThemeGroup.writeEntry("ToolbarDefault", "22");
+    iconThemeGroup.writeEntry("ToolbarSizes", "16,22,32,48");
+    iconThemeGroup.writeEntry("MainToolbarDefault", "22");
+    iconThemeGroup.writeEntry("MainToolbarSizes", "16,22,32,48");
+    iconThemeGroup.writeEntry("SmallDefault", "16");
+    iconThemeGroup.writeEntry("SmallSizes", "16,22,32,48");
+    iconThemeGroup.writeEntry("PanelDefault", "48");
+    iconThemeGroup.writeEntry("PanelSizes", "16,22,32,48,64,128,256");
+    iconThemeGroup.writeEntry("DialogDefault", "32");
+    iconThemeGroup.writeEntry("DialogSizes", "16,22,32,48,64,128,256");
+
+    iconThemeGroup.writeEntry("KDE-Extensions", ".svg");
+
+    // used the Application Menu button type as a reference to define a "bland" standard icon colour which the KDE svg renderer should replace from the system
+    // colour scheme
+    QColor blandIconColor = decorationColors.buttonPalette(DecorationButtonType::ApplicationMenu)->active()->foregroundNormal;
+    if (!blandIconColor.isValid()) {
+        blandIconColor = decorationColors.buttonPalette(DecorationButtonType::ApplicationMenu)->active()->foregroundHover;
+    }
+    QString blandIconColorString = blandIconColor.name();
+
+    // content-addressing of the generated icons: an icon is only rendered and written if the hash of its inputs has changed
+    const QByteArray themeInputsHash(inputsHash(decorationColors));
+    const QHash<QString, QByteArray> previousHashes(readHashes(themeDirPath));
+    QHash<QString, QSet<QString>> expectedFiles;
+
+    for (int i = 0; i < m_scales.count(); i++) {
+        for (auto size = m_iconSizes.begin(); size != m_iconSizes.end(); size++) {
+            QString svgDirName;
+            if (m_scales[i] == 1.0) {
+                svgDirName = QString::number(*size);
+            } else {
+                svgDirName = QString::number(*size) % QStringLiteral("@") % QString::number(m_scales[i]) % "x";
+            }
+            QString svgDirPath = themeDirPath % QStringLiteral("/") % svgDirName;
+            QDir dir(svgDirPath);
+            dir.mkpath(svgDirPath);
+
+            if (i == 0) {
+                if (!iconThemeGroup.readEntry("Directories", "").isEmpty()) {
+                    iconThemeGroup.writeEntry("Directories", iconThemeGroup.readEntry("Directories") + "," + svgDirName);
+                } else {
+                    iconThemeGroup.writeEntry("Directories", svgDirName);
+                }
+            } else {
+                if (!iconThemeGroup.readEntry("ScaledDirectories", "").isEmpty()) {
+                    iconThemeGroup.writeEntry("ScaledDirectories", iconThemeGroup.readEntry("ScaledDirectories") + "," + svgDirName);
+                } else {
+                    iconThemeGroup.writeEntry("ScaledDirectories", svgDirName);
+                }
+            }
+
+            KConfigGroup svgDirGroup = themeIndex.group(svgDirName);
+            svgDirGroup.writeEntry("Size", QString::number(*size));
+            if (i != 0) {
+                svgDirGroup.writeEntry("Scale", QString::number(m_scales[i]));
+            }
+            svgDirGroup.writeEntry("Context", "Actions");
+            if (*size == 32) {
+                svgDirGroup.writeEntry("Type", "Scalable");
+                svgDirGroup.writeEntry("MinSize", "32");
+                svgDirGroup.writeEntry("MaxSize", "256");
+            } else {
+                svgDirGroup.writeEntry("Type", "Fixed");
+            }
+
+            for (auto &iconType : m_iconTypes) {
+                const QString fileName(iconType.name % QStringLiteral(".svg"));
+                const QString relativePath(svgDirName % QStringLiteral("/") % fileName);
+                const QString filePath(svgDirPath % QStringLiteral("/") % fileName);
+                expectedFiles[svgDirName].insert(fileName);
+
+                const QByteArray hash(QCryptographicHash::hash(themeInputsHash + relativePath.toUtf8(), QCryptographicHash::Sha1).toHex());
+                const bool upToDate(previousHashes.value(relativePath) == hash && QFile::exists(filePath));
+                jobs.append({themeDirPath, relativePath, hash, &iconType, *size, m_scales.at(i), &decorationColors, blandIconColorString, upToDate});
+            }
+        }
+    }
+
+    removeStaleFiles(themeDirPath, expectedFiles);
+
+    // copy desktop icons from .qrc file, depending upon theme panel position. They have a different "Places" context
+    QString desktopPath = themeDirPath + "/places";
+    QDir desktopDir(desktopPath);
+    desktopDir.mkpath(desktopPath);
+    desktopDir.mkdir("16");
+
+    // the link targets are relative, so that the links still resolve if the theme directory is moved.
+    // The links themselves are given absolute paths, as changing the working directory would affect the whole of the host process
+    QFile::link(QStringLiteral("16"), desktopPath + QStringLiteral("/16@2x"));
+    QFile::link(QStringLiteral("16"), desktopPath + QStringLiteral("/16@3x"));
+    desktopDir.mkdir("22");
+    QFile::link(QStringLiteral("22"), desktopPath + QStringLiteral("/22@2x"));
+    QFile::link(QStringLiteral("22"), desktopPath + QStringLiteral("/22@3x"));
+    desktopDir.mkdir("32");
+    desktopDir.mkdir("48");
+    desktopDir.mkdir("64");
+    desktopDir.mkdir("96");
+
+    QString basePanelDir;
+    switch (m_panelSide) {
+    case SideBottom:
+    default:
+        basePanelDir = ":/icons/bottompanel";
+        break;
+    case SideLeft:
+        basePanelDir = ":/icons/leftpanel";
+        break;
+    case SideTop:
+        basePanelDir = ":/icons/toppanel";
+        break;
+    case SideRight:
+        basePanelDir = ":/icons/rightpanel";
+        break;
+    }
+    copyIfChanged(basePanelDir + "/16/desktop.svg", desktopPath + "/16/desktop.svg");
+    copyIfChanged(basePanelDir + "/16/desktop-symbolic.svg", desktopPath + "/16/desktop-symbolic.svg");
+    copyIfChanged(basePanelDir + "/16/user-desktop.svg", desktopPath + "/16/user-desktop.svg");
+    copyIfChanged(basePanelDir + "/16/user-desktop-symbolic.svg", desktopPath + "/16/user-desktop-symbolic.svg");
+    copyIfChanged(basePanelDir + "/22/desktop.svg", desktopPath + "/22/desktop.svg");
+    copyIfChanged(basePanelDir + "/22/desktop-symbolic.svg", desktopPath + "/22/desktop-symbolic.svg");
+    copyIfChanged(basePanelDir + "/22/user-desktop.svg", desktopPath + "/22/user-desktop.svg");
+    copyIfChanged(basePanelDir + "/22/user-desktop-symbolic.svg", desktopPath + "/22/user-desktop-symbolic.svg");
+    copyIfChanged(basePanelDir + "/32/desktop.svg", desktopPath + "/32/desktop.svg");
+    copyIfChanged(basePanelDir + "/32/desktop-symbolic.svg", desktopPath + "/32/desktop-symbolic.svg");
+    copyIfChanged(basePanelDir + "/32/user-desktop.svg", desktopPath + "/32/user-desktop.svg");
+    copyIfChanged(basePanelDir + "/32/user-desktop-symbolic.svg", desktopPath + "/32/user-desktop-symbolic.svg");
+    copyIfChanged(basePanelDir + "/48/desktop.svg", desktopPath + "/48/desktop.svg");
+    copyIfChanged(basePanelDir + "/48/user-desktop.svg", desktopPath + "/48/user-desktop.svg");
+    copyIfChanged(basePanelDir + "/64/desktop.svg", desktopPath + "/64/desktop.svg");
+    copyIfChanged(basePanelDir + "/64/user-desktop.svg", desktopPath + "/64/user-desktop.svg");
+    copyIfChanged(basePanelDir + "/96/desktop.svg", desktopPath + "/96/desktop.svg");
+    copyIfChanged(basePanelDir + "/96/user-desktop.svg", desktopPath + "/96/user-desktop.svg");
+
+    // write index file entries for desktop icons
+    QString desktopDirNames = "places/16,places/22,places/32,places/48,places/64,places/96";
+    if (!iconThemeGroup.readEntry("Directories", "").isEmpty()) {
+        iconThemeGroup.writeEntry("Directories", iconThemeGroup.readEntry("Directories") + "," + desktopDirNames);
+    } else {
+        iconThemeGroup.writeEntry("Directories", desktopDirNames);
+    }
+
+    QString desktopScaledDirNames = "places/16@2x,places/16@3x,places/22@2x,places/22@3x";
+    if (!iconThemeGroup.readEntry("ScaledDirectories", "").isEmpty()) {
+        iconThemeGroup.writeEntry("ScaledDirectories", iconThemeGroup.readEntry("ScaledDirectories") + "," + desktopScaledDirNames);
+    } else {
+        iconThemeGroup.writeEntry("ScaledDirectories", desktopScaledDirNames);
+    }
+
+    KConfigGroup svgDirGroup = themeIndex.group("places/16");
+    svgDirGroup.writeEntry("Size", "16");
+    svgDirGroup.writeEntry("Scale", "1");
+    svgDirGroup.writeEntry("Context", "Places");
+    svgDirGroup.writeEntry("Type", "Fixed");
+    svgDirGroup.writeEntry("MinSize", "16");
+
+    svgDirGroup = themeIndex.group("places/16@2x");
+    svgDirGroup.writeEntry("Size", "16");
+    svgDirGroup.writeEntry("Scale", "2");
+    svgDirGroup.writeEntry("Context", "Places");
+    svgDirGroup.writeEntry("Type", "Fixed");
+    svgDirGroup.writeEntry("MinSize", "16");
+
+    svgDirGroup = themeIndex.group("places/16@3x");
+    svgDirGroup.writeEntry("Size", "16");
+    svgDirGroup.writeEntry("Scale", "3");
+    svgDirGroup.writeEntry("Context", "Places");
+    svgDirGroup.writeEntry("Type", "Fixed");
+    svgDirGroup.writeEntry("MinSize", "16");
+
+    svgDirGroup = themeIndex.group("places/22");
+    svgDirGroup.writeEntry("Size", "22");
+    svgDirGroup.writeEntry("Scale", "1");
+    svgDirGroup.writeEntry("Context", "Places");
+    svgDirGroup.writeEntry("Type", "Fixed");
+
+    svgDirGroup = themeIndex.group("places/22@2x");
+    svgDirGroup.writeEntry("Size", "22");
+    svgDirGroup.writeEntry("Scale", "2");
+    svgDirGroup.writeEntry("Context", "Places");
+    svgDirGroup.writeEntry("Type", "Fixed");
+
+    svgDirGroup = themeIndex.group("places/22@3x");
+    svgDirGroup.writeEntry("Size", "22");
+    svgDirGroup.writeEntry("Scale", "3");
+    svgDirGroup.writeEntry("Context", "Places");
+    svgDirGroup.writeEntry("Type", "Fixed");
+
+    svgDirGroup = themeIndex.group("places/32");
+    svgDirGroup.writeEntry("Size", "32");
+    svgDirGroup.writeEntry("Scale", "1");
+    svgDirGroup.writeEntry("Context", "Places");
+    svgDirGroup.writeEntry("Type", "Fixed");
+
+    svgDirGroup = themeIndex.group("places/48");
+    svgDirGroup.writeEntry("Size", "48");
+    svgDirGroup.writeEntry("Scale", "1");
+    svgDirGroup.writeEntry("Context", "Places");
+    svgDirGroup.writeEntry("Type", "Fixed");
+
+    svgDirGroup = themeIndex.group("places/96");
+    svgDirGroup.writeEntry("Size", "96");
+    svgDirGroup.writeEntry("Scale", "1");
+    svgDirGroup.writeEntry("Context", "Places");
+    svgDirGroup.writeEntry("Type", "Scalable");
+    svgDirGroup.writeEntry("MinSize", "96");
+    svgDirGroup.writeEntry("MaxSize", "256");
+
+    themeIndex.sync();
+
+    // only replace index.theme if it has changed, so that icon caches across the desktop are not needlessly invalidated
+    QFile newIndexFile(newIndexPath);
+    if (newIndexFile.open(QIODevice::ReadOnly)) {
+        writeIfChanged(themeDirPath % QStringLiteral("/index.theme"), newIndexFile.readAll());
+        newIndexFile.close();
+    }
+    newIndexFile.remove();
+}
+
+QByteArray SystemIconGenerator::renderIcon(const iconType &iconType,
+                                           const int size,
+                                           const qreal scale,
+                                           const DecorationColors &decorationColors,
+                                           const QString &blandIconColorString) const
+{
+    int scaledWidth = qRound(size * scale);
+    QSize iconSizeScaled(scaledWidth, scaledWidth);
+    SvgIconWriter svgWriter(iconSizeScaled, qRound(96 * scale));
+    svgWriter.setDescription(m_svgDescription);
+    std::unique_ptr<QPainter> painter = std::make_unique<QPainter>();
+    painter->begin(&svgWriter);
+
+    painter->setViewport(QRect(QPoint(0, 0), iconSizeScaled));
+    painter->setRenderHints(QPainter::RenderHint::Antialiasing);
+
+    QColor textColor = decorationColors.buttonPalette(iconType.type)->active()->foregroundNormal;
+    if (!textColor.isValid()) {
+        textColor = decorationColors.buttonPalette(iconType.type)->active()->foregroundHover;
+    }
+    QString textColorString = textColor.name();
+    QPen pen((QColor(textColorString)));
+
+    // bland icons are given the colour scheme text colour so KIconLoader can replace it with that of the current colour scheme
+    svgWriter.setColorSchemeTextColor(QColor(textColorString), textColorString == blandIconColorString);
+
+    bool boldButtons = (m_internalSettings->boldButtonIcons() == InternalSettings::EnumBoldButtonIcons::BoldIconsBold
+                        || (m_internalSettings->boldButtonIcons() == InternalSettings::EnumBoldButtonIcons::BoldIconsHiDpiOnly && scale >= 1.2)
+                        || m_internalSettings->boldButtonIcons() == InternalSettings::EnumBoldButtonIcons::BoldIconsActive
+                        || (m_internalSettings->boldButtonIcons() == InternalSettings::EnumBoldButtonIcons::BoldIconsActiveHiDpi && scale >= 1.2));
+
+    // paint the close background to SVG
+    if (iconType.type == DecorationButtonType::Close && iconType.name != QStringLiteral("window-close-symbolic")) {
+        painter->setWindow(0, 0, 16, 16);
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(decorationColors.buttonPalette(iconType.type)->active()->backgroundHover);
+
+        if (m_internalSettings->buttonShape() == InternalSettings::EnumButtonShape::ShapeSmallCircle) {
+            boldButtons ? painter->drawEllipse(QRectF(0, 0, 16, 16)) : painter->drawEllipse(QRectF(1, 1, 14, 14));
+        } else {
+            qreal cornerRadius = 0;
+            if (m_internalSettings->buttonShape() == InternalSettings::EnumButtonShape::ShapeSmallRoundedSquare
+                || m_internalSettings->buttonShape() == InternalSettings::EnumButtonShape::ShapeFullHeightRoundedRectangle
+                || m_internalSettings->buttonShape() == InternalSettings::EnumButtonShape::ShapeIntegratedRoundedRectangle
+                || m_internalSettings->buttonShape() == InternalSettings::EnumButtonShape::ShapeIntegratedRoundedRectangleGrouped) {
+                if (m_internalSettings->buttonCornerRadius() == InternalSettings::EnumButtonCornerRadius::Custom) {
+                    cornerRadius = m_internalSettings->buttonCustomCornerRadius();
+                } else {
+                    cornerRadius = m_internalSettings->windowCornerRadius();
+                }
+            }
+
+            if ((cornerRadius < 0.4 && m_internalSettings->windowCornerRadius() < 4))
+                painter->drawRect(QRectF(2, 2, 12, 12));
+            else
+                painter->drawRoundedRect(QRectF(2, 2, 12, 12), 20, 20, Qt::RelativeSize);
+        }
+        pen.setColor(textColor = decorationColors.buttonPalette(iconType.type)->active()->foregroundHover);
+    }
+
+    // paint the icon to SVG
+    auto [iconRenderer, localRenderingWidth](RenderDecorationButtonIcon::factory(m_internalSettings, painter.get(), false, boldButtons, scale));
+    painter->setWindow(0, 0, localRenderingWidth, localRenderingWidth);
+
+    pen.setWidthF(PenWidth::Symbol * qMax((qreal)1.0, qreal(localRenderingWidth) / iconSizeScaled.width()));
+    painter->setPen(pen);
+    iconRenderer->setForceEvenSquares(true);
+    iconRenderer->setStrokeToFilledPath(true);
+    iconRenderer->setTaskManagerSide(m_taskManagerSide);
+
+    iconRenderer->renderIcon(iconType.type, iconType.checked);
+
+    painter->end();
+
+    return svgWriter.svg();
+}
+
+QByteArray SystemIconGenerator::inputsHash(const DecorationColors &decorationColors) const
+{
+    QByteArray inputs;
+    QDataStream stream(&inputs, QIODevice::WriteOnly);
+    stream << m_hashVersion << int(m_taskManagerSide);
+
+    // settings that can affect the rendered icons. Animation and exception settings are never used to render an icon
+    const auto items = m_internalSettings->items();
+    for (const KConfigSkeletonItem *item : items) {
+        if (SettingsChangeTools::itemChanges(item) & (SettingsChangeColors | SettingsChangeShadow | SettingsChangeGeometry | SettingsChangeIcons)) {
+            stream << item->key() << item->property();
+        }
+    }
+
+    // the generated colours also depend on the system palette
+    for (auto &iconType : m_iconTypes) {
+        const auto palette = decorationColors.buttonPalette(iconType.type)->active();
+        stream << palette->foregroundNormal << palette->foregroundHover << palette->backgroundHover;
+    }
+
+    return QCryptographicHash::hash(inputs, QCryptographicHash::Sha1);
+}
+
+QHash<QString, QByteArray> SystemIconGenerator::readHashes(const QString &themeDirPath)
+{
+    QHash<QString, QByteArray> hashes;
+    QFile file(themeDirPath % QStringLiteral("/") % m_hashesFileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return hashes;
+    }
+
+    while (!file.atEnd()) {
+        const QList<QByteArray> fields(file.readLine().trimmed().split(' '));
+        if (fields.count() == 2) {
+            hashes.insert(QString::fromUtf8(fields.at(0)), fields.at(1));
+        }
+    }
+    return hashes;
+}
+
+void SystemIconGenerator::writeHashes(const QString &themeDirPath, const QHash<QString, QByteArray> &hashes)
+{
+    QStringList relativePaths(hashes.keys());
+    relativePaths.sort();
+
+    QByteArray data;
+    for (const QString &relativePath : std::as_const(relativePaths)) {
+        data += relativePath.toUtf8() + ' ' + hashes.value(relativePath) + '\n';
+    }
+    writeIfChanged(themeDirPath % QStringLiteral("/") % m_hashesFileName, data);
+}
+
+bool SystemIconGenerator::writeIfChanged(const QString &filePath, const QByteArray &data)
+{
+    QFile existingFile(filePath);
+    if (existingFile.open(QIODevice::ReadOnly)) {
+        const bool unchanged(existingFile.size() == data.size() && existingFile.readAll() == data);
+        existingFile.close();
+        if (unchanged) {
+            return true;
+        }
+    }
+
+    // write to a temporary file and rename, so that an icon is never seen partially-written
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(data);
+    return file.commit();
+}
+
+bool SystemIconGenerator::copyIfChanged(const QString &sourcePath, const QString &destinationPath)
+{
+    QFile sourceFile(sourcePath);
+    if (!sourceFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    return writeIfChanged(destinationPath, sourceFile.readAll());
+}
+
+void SystemIconGenerator::removeStaleFiles(const QString &themeDirPath, const QHash<QString, QSet<QString>> &expectedFiles)
+{
+    QDir themeDir(themeDirPath);
+    const QStringList dirNames(themeDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot));
+    for (const QString &dirName : dirNames) {
+        if (dirName == QStringLiteral("places")) {
+            continue;
+        }
+
+        // directories from scales that are no longer present
+        if (!expectedFiles.contains(dirName)) {
+            QDir(themeDir.filePath(dirName)).removeRecursively();
+            continue;
+        }
+
+        QDir dir(themeDir.filePath(dirName));
+        const QStringList fileNames(dir.entryList(QDir::Files));
+        const QSet<QString> &expectedDirFiles(expectedFiles[dirName]);
+        for (const QString &fileName : fileNames) {
+            if (!expectedDirFiles.contains(fileName)) {
+                dir.remove(fileName);
+            }
+        }
+    }
+}
+
+void SystemIconGenerator::addSystemScales()
+{
+    QString outputsPath = QStandardPaths::locate(QStandardPaths::GenericDataLocation, QStringLiteral("kscreen/outputs"), QStandardPaths::LocateDirectory);
+    QDir outputsDir(outputsPath);
+    if (!outputsDir.exists())
+        return;
+
+    QStringList outputsFiles = outputsDir.entryList(QDir::Files);
+
+    for (QString &outputFile : outputsFiles) {
+        QFile file(outputsPath % QStringLiteral("/") % outputFile);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+            continue;
+
+        QJsonDocument document = QJsonDocument::fromJson(file.readAll());
+        file.close();
+        QJsonObject jsonObj = document.object();
+        QVariantMap jsonMap = jsonObj.toVariantMap();
+        qreal scale = jsonMap.value(QStringLiteral("scale"), 1.0).toDouble();
+        if (scale < (0.5 - 0.0001) || scale > (3.0 + 0.0001))
+            continue;
+
+        bool scaleInList = false;
+        for (auto i = m_scales.begin(); i != m_scales.end(); i++) {
+            if (qAbs(*i - scale) < 0.0001) {
+                scaleInList = true;
+                break;
+            }
+        }
+
+        if (!scaleInList) {
+            m_scales.append(scale);
+        }
+    }
+}
+
+}
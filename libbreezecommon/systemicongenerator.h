@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: 2024 Paul A McAuley <kde@paulmcauley.com>
+ * SPDX-FileCopyrightText: 2024-2026 Paul A McAuley <kde@paulmcauley.com>
  *
  * SPDX-License-Identifier: MIT
  */
@@ -9,31 +9,93 @@
 #include "breeze.h"
 #include "decorationcolors.h"
 
+#include <QHash>
+#include <QPalette>
+#include <QSet>
+
+#include <atomic>
+
 namespace Breeze
 {
 
 class SystemIconGenerator
 {
 public:
-    SystemIconGenerator(InternalSettingsPtr internalSettings);
+    //* palette is the application palette, read in the calling thread as generate() may run in another.
+    //* cancelled, if set, is polled while generating
+    SystemIconGenerator(InternalSettingsPtr internalSettings, const QPalette &palette, const std::atomic_bool *cancelled = nullptr);
 
-    void generate();
+    //* generate the klassy and klassy-dark icon themes. Returns false if cancelled
+    bool generate();
 
 private:
+    struct iconType {
+        DecorationButtonType type;
+        bool checked;
+        QString name;
+    };
+
+    //* a single icon file to generate
+    struct IconJob {
+        QString themeDirPath;
+        QString relativePath;
+        QByteArray hash;
+        const iconType *type;
+        int size;
+        qreal scale;
+        const DecorationColors *decorationColors;
+        QString blandIconColorString;
+        bool succeeded; // initially true if the icon is already up-to-date
+    };
+
     void addSystemScales();
-    void generateIconThemeDir(const QString themeDirPath, const QString themeName, const QString inherits, const DecorationColors &decorationColors);
+
+    //* write the index and desktop icons of a theme, and append the icons to generate to jobs
+    void generateIconThemeDir(const QString themeDirPath,
+                              const QString themeName,
+                              const QString inherits,
+                              const DecorationColors &decorationColors,
+                              QList<IconJob> &jobs);
+
+    //* render and write the icons that are not up-to-date, in parallel
+    void renderIcons(QList<IconJob> &jobs) const;
+
+    //* render a single icon to SVG, with the colours modified so that KIconLoader can replace them from the current colour scheme
+    QByteArray
+    renderIcon(const iconType &iconType, const int size, const qreal scale, const DecorationColors &decorationColors, const QString &blandIconColorString) const;
+
+    //* hash of all the settings and colours that the icons of a theme are rendered from
+    QByteArray inputsHash(const DecorationColors &decorationColors) const;
+
+    //* hashes of the inputs of each generated icon, keyed by path relative to the theme directory
+    static QHash<QString, QByteArray> readHashes(const QString &themeDirPath);
+    static void writeHashes(const QString &themeDirPath, const QHash<QString, QByteArray> &hashes);
+
+    //* atomically write data to a file, leaving the file untouched if it already has the same contents. Returns false on error
+    static bool writeIfChanged(const QString &filePath, const QByteArray &data);
+    static bool copyIfChanged(const QString &sourcePath, const QString &destinationPath);
+
+    //* remove icons and scale directories left from a previous generation that are no longer generated
+    static void removeStaleFiles(const QString &themeDirPath, const QHash<QString, QSet<QString>> &expectedFiles);
+
+    bool isCancelled() const
+    {
+        return m_cancelled && *m_cancelled;
+    }
 
     InternalSettingsPtr m_internalSettings;
+    const QPalette m_palette;
+    const std::atomic_bool *m_cancelled;
+
+    const QString m_svgDescription;
+
+    //* increment when the rendering of the icons changes, so that all icons are regenerated
+    static constexpr int m_hashVersion = 2;
+    static constexpr QLatin1String m_hashesFileName{".klassy-icon-hashes"};
 
     QList<qreal> m_scales{1, 1.25, 1.5, 1.75, 2, 2.25, 2.5, 2.75, 3};
     const QList<int> m_iconSizes{16, 18, 20, 22, 24, 32, 48};
 
-    struct iconType {
-        DecorationButtonType type;
-        bool checked;
-        QString name;
-    };
-
     const QList<iconType> m_iconTypes{
         {DecorationButtonType::ApplicationMenu, false, QStringLiteral("application-menu-symbolic")},
         {DecorationButtonType::ApplicationMenu, false, QStringLiteral("application-menu")},